@@ -0,0 +1,51 @@
+// benchmarks/compile-meta.cpp                                      -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Compile-time benchmark of the meta functions used to compute completion
+// signatures. BENCHMARK_SIZE is the number of elements of the processed lists.
+
+#include <beman/execution/detail/meta_combine.hpp>
+#include <beman/execution/detail/meta_filter.hpp>
+#include <beman/execution/detail/meta_transform.hpp>
+#include <beman/execution/detail/meta_unique.hpp>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#ifndef BENCHMARK_SIZE
+#define BENCHMARK_SIZE 100
+#endif
+
+// ----------------------------------------------------------------------------
+
+namespace {
+namespace meta = beman::execution::detail::meta;
+
+template <std::size_t>
+struct tag {};
+template <typename...>
+struct list {};
+
+template <typename>
+struct is_even : std::false_type {};
+template <std::size_t I>
+struct is_even<tag<I>> : std::bool_constant<I % 2u == 0u> {};
+template <typename T>
+using as_signature = void(T);
+
+// a list of `Size` elements with each element appearing twice
+template <std::size_t Size, typename = std::make_index_sequence<Size>>
+struct make_list;
+template <std::size_t Size, std::size_t... I>
+struct make_list<Size, std::index_sequence<I...>> {
+    using type = list<tag<I % (Size / 2u + 1u)>...>;
+};
+
+using input    = typename make_list<BENCHMARK_SIZE>::type;
+using unique   = meta::unique<input>;
+using filtered = meta::filter<is_even, input>;
+using combined = meta::combine<input, filtered, unique, input>;
+using result   = meta::unique<meta::transform<as_signature, combined>>;
+} // namespace
+
+auto main() -> int { return sizeof(result) == 0u; }
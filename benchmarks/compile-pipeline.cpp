@@ -0,0 +1,42 @@
+// benchmarks/compile-pipeline.cpp                                  -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Compile-time benchmark computing the completion signatures of a pipeline
+// of BENCHMARK_SIZE stages, each consisting of let_value, then, and upon_error.
+
+#include <beman/execution/execution.hpp>
+#include <cstddef>
+#include <utility>
+
+#ifndef BENCHMARK_SIZE
+#define BENCHMARK_SIZE 4
+#endif
+
+// ----------------------------------------------------------------------------
+
+namespace {
+namespace ex = beman::execution;
+
+template <std::size_t I>
+struct value {};
+
+template <std::size_t I, typename Sender>
+auto stage(Sender&& sndr) {
+    return std::forward<Sender>(sndr) | ex::let_value([](auto&&...) { return ex::just(value<I>{}); }) |
+           ex::then([](value<I>) { return value<I + 1u>{}; }) |
+           ex::upon_error([](auto&&) { return value<I + 1u>{}; });
+}
+
+template <std::size_t I, std::size_t N, typename Sender>
+auto pipeline(Sender&& sndr) {
+    if constexpr (I == N)
+        return std::forward<Sender>(sndr);
+    else
+        return pipeline<I + 1u, N>(stage<I>(std::forward<Sender>(sndr)));
+}
+
+using sender_t     = decltype(pipeline<0u, BENCHMARK_SIZE>(ex::just()));
+using signatures_t = ex::completion_signatures_of_t<sender_t, ex::empty_env>;
+} // namespace
+
+auto main() -> int { return sizeof(signatures_t) == 0u; }
@@ -0,0 +1,48 @@
+# cmake-format: off
+# benchmarks/measure-build.cmake -*-makefile-*-
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+# cmake-format: on
+
+# Builds DEPENDENCY and then, for each of TARGETS, removes the target's object
+# files listed in <target>_OBJECTS and reports the wall clock time of building
+# the target again. The builds are serial to make the times comparable.
+#
+# Parameters: BUILD_DIR, CONFIG, DEPENDENCY, TARGETS, <target>_OBJECTS
+
+set(build_args --parallel 1)
+if(CONFIG)
+    list(APPEND build_args --config ${CONFIG})
+endif()
+
+execute_process(
+    COMMAND
+        ${CMAKE_COMMAND} --build ${BUILD_DIR} ${build_args} --target
+        ${DEPENDENCY}
+    RESULT_VARIABLE result
+    OUTPUT_VARIABLE output
+    ERROR_VARIABLE output
+)
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "building ${DEPENDENCY} failed:\n${output}")
+endif()
+
+foreach(target ${TARGETS})
+    if(${target}_OBJECTS)
+        file(REMOVE ${${target}_OBJECTS})
+    endif()
+    string(TIMESTAMP start "%s%f")
+    execute_process(
+        COMMAND
+            ${CMAKE_COMMAND} --build ${BUILD_DIR} ${build_args} --target
+            ${target}
+        RESULT_VARIABLE result
+        OUTPUT_VARIABLE output
+        ERROR_VARIABLE output
+    )
+    string(TIMESTAMP end "%s%f")
+    math(EXPR milliseconds "(${end} - ${start}) / 1000")
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "building ${target} failed:\n${output}")
+    endif()
+    message(STATUS "${target}: ${milliseconds} ms")
+endforeach()
@@ -0,0 +1,53 @@
+# cmake-format: off
+# benchmarks/measure-compile.cmake -*-makefile-*-
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+# cmake-format: on
+
+# Compiles SOURCE once for each of the comma separated SIZES passed as
+# BENCHMARK_SIZE and reports the wall clock time and, if GNU time is
+# available, the peak memory of the compiler.
+#
+# Parameters: COMPILER, FLAGS (comma separated), INCLUDE_DIR, SOURCE, SIZES
+
+string(REPLACE "," ";" sizes "${SIZES}")
+string(REPLACE "," ";" flags "${FLAGS}")
+get_filename_component(name ${SOURCE} NAME_WE)
+
+find_program(GNU_TIME NAMES time PATHS /usr/bin /usr/local/bin NO_DEFAULT_PATH)
+set(time_prefix)
+if(GNU_TIME)
+    execute_process(
+        COMMAND ${GNU_TIME} --version
+        OUTPUT_VARIABLE time_version
+        ERROR_VARIABLE time_version
+        RESULT_VARIABLE time_result
+    )
+    if(time_result EQUAL 0 AND time_version MATCHES "GNU")
+        set(time_prefix ${GNU_TIME} -f "max-rss-kib=%M")
+    endif()
+endif()
+
+foreach(size ${sizes})
+    string(TIMESTAMP start "%s%f")
+    execute_process(
+        COMMAND
+            ${time_prefix} ${COMPILER} ${flags} -I${INCLUDE_DIR}
+            -DBENCHMARK_SIZE=${size} ${SOURCE}
+        RESULT_VARIABLE result
+        OUTPUT_VARIABLE output
+        ERROR_VARIABLE output
+    )
+    string(TIMESTAMP end "%s%f")
+    math(EXPR milliseconds "(${end} - ${start}) / 1000")
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "${name} BENCHMARK_SIZE=${size} failed:\n${output}")
+    endif()
+    set(memory "n/a")
+    if(output MATCHES "max-rss-kib=([0-9]+)")
+        set(memory "${CMAKE_MATCH_1} KiB")
+    endif()
+    message(
+        STATUS
+        "${name} BENCHMARK_SIZE=${size}: ${milliseconds} ms, peak memory ${memory}"
+    )
+endforeach()
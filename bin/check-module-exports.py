@@ -0,0 +1,115 @@
+#!/usr/bin/python3
+# bin/check-module-exports.py
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+# Compares the names exported by the module interface with the names the
+# headers it includes declare in namespace beman::execution such that the
+# export list can't silently drift from the headers. Exits with 1 and lists
+# the differences if there are any.
+
+import os
+import re
+import sys
+
+include_re = re.compile(r"#include\s*<(beman/execution/[^>]*)>")
+comment_re = re.compile(r"//[^\n]*|/\*.*?\*/", re.DOTALL)
+string_re = re.compile(r'"(?:\\.|[^"\\\n])*"')
+namespace_re = re.compile(r"\bnamespace\s+beman::execution\s*\{")
+export_re = re.compile(r"^using ::beman::execution::(?P<name>\w+);", re.MULTILINE)
+
+# declarations at namespace scope after removing any template header: the
+# statements are split at ';' and at '{}' and may contain a requires-clause
+declaration_res = [
+    re.compile(r"(?:^|\s)(?:struct|class|union|enum(?:\s+class)?)\s+(?P<name>\w+)"),
+    re.compile(r"\busing\s+(?P<name>\w+)\s*="),
+    re.compile(r"\bconcept\s+(?P<name>\w+)\s*="),
+    re.compile(r"^using\s+(?:::)?beman::execution::detail::(?:\w+::)*(?P<name>\w+)$"),
+    re.compile(r"\binline\s+constexpr\b[^=]*?\b(?P<name>\w+)\s*(?:=.*)?$"),
+    re.compile(r"(?:^|\s)(?:inline\s+)?(?:constexpr\s+)?auto\s+(?P<name>\w+)\s*\("),
+]
+
+
+def strip_template(statement):
+    """Removes a leading template header, e.g., 'template <typename T, template <typename> class C>'."""
+    if not re.match(r"template\s*<", statement):
+        return statement
+    depth = 0
+    for pos, c in enumerate(statement):
+        if c == "<":
+            depth += 1
+        elif c == ">":
+            depth -= 1
+            if depth == 0:
+                return statement[pos + 1 :].lstrip()
+    return statement
+
+def headers(root, header, seen):
+    if header in seen:
+        return
+    seen.add(header)
+    with open(os.path.join(root, header)) as input:
+        text = input.read()
+    for include in include_re.findall(text):
+        headers(root, include, seen)
+
+
+def block(text, start):
+    """Returns the body of the block opened right before start with nested blocks collapsed to '{}'."""
+    depth = 1
+    result = []
+    pos = start
+    while depth != 0:
+        c = text[pos]
+        if c == "{":
+            depth += 1
+            if depth == 2:
+                result.append("{}")
+        elif c == "}":
+            depth -= 1
+        elif depth == 1:
+            result.append(c)
+        pos += 1
+    return "".join(result)
+
+
+def declared(text):
+    text = string_re.sub('""', comment_re.sub(" ", text))
+    text = "\n".join(line for line in text.split("\n") if not line.lstrip().startswith("#"))
+    names = set()
+    for match in namespace_re.finditer(text):
+        body = block(text, match.end())
+        for statement in re.split(r";|\{\}", body):
+            statement = strip_template(" ".join(statement.split()))
+            for declaration_re in declaration_res:
+                match = declaration_re.search(statement)
+                if match:
+                    names.add(match.group("name"))
+                    break
+    return names
+
+
+if len(sys.argv) != 3:
+    print(f"usage: {sys.argv[0]} <path>/include <path>/execution.cppm")
+    sys.exit(1)
+
+root, interface = sys.argv[1], sys.argv[2]
+with open(interface) as input:
+    module = input.read()
+
+seen = set()
+for include in include_re.findall(module):
+    headers(root, include, seen)
+
+names = set()
+for header in seen:
+    with open(os.path.join(root, header)) as input:
+        names |= declared(input.read())
+
+exported = set(export_re.findall(module))
+missing = sorted(names - exported)
+extra = sorted(exported - names)
+for name in missing:
+    print(f"{interface}: missing export of beman::execution::{name}")
+for name in extra:
+    print(f"{interface}: export of beman::execution::{name} isn't declared by the headers")
+sys.exit(1 if missing or extra else 0)
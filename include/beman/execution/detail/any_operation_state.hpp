@@ -0,0 +1,222 @@
+// include/beman/execution/detail/any_operation_state.hpp           -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef INCLUDED_BEMAN_EXECUTION_DETAIL_ANY_OPERATION_STATE
+#define INCLUDED_BEMAN_EXECUTION_DETAIL_ANY_OPERATION_STATE
+
+#include <beman/execution/detail/any_receiver_ref.hpp>
+#include <beman/execution/detail/emplace_from.hpp>
+#include <beman/execution/detail/get_allocator.hpp>
+#include <beman/execution/detail/get_env.hpp>
+#include <beman/execution/detail/get_stop_token.hpp>
+#include <beman/execution/detail/immovable.hpp>
+#include <beman/execution/detail/inplace_stop_source.hpp>
+#include <beman/execution/detail/operation_state.hpp>
+#include <beman/execution/detail/query_with_default.hpp>
+#include <beman/execution/detail/start.hpp>
+#include <beman/execution/detail/stop_callback_for_t.hpp>
+#include <beman/execution/detail/unstoppable_token.hpp>
+
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+// ----------------------------------------------------------------------------
+
+namespace beman::execution::detail {
+/*!
+ * \brief Type-erased reference to an allocator used for out-of-line operation states
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ * \internal
+ */
+struct any_allocator_ref {
+    void* context;
+    auto (*allocate)(void*, ::std::size_t) -> void*;
+    auto (*deallocate)(void*, void*, ::std::size_t) noexcept -> void;
+};
+
+/*!
+ * \brief Creates an any_allocator_ref for an allocator object
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ * \internal
+ *
+ * \details
+ * Memory is obtained as an array of `std::max_align_t` objects from the
+ * allocator rebound to that type, i.e., the allocated memory is suitably
+ * aligned for any object which is not over-aligned.
+ */
+template <typename Allocator>
+auto make_any_allocator_ref(Allocator& allocator) noexcept -> ::beman::execution::detail::any_allocator_ref {
+    using unit_t   = ::std::max_align_t;
+    using alloc_t  = typename ::std::allocator_traits<Allocator>::template rebind_alloc<unit_t>;
+    using traits_t = ::std::allocator_traits<alloc_t>;
+    static constexpr auto count{[](::std::size_t size) { return (size + sizeof(unit_t) - 1u) / sizeof(unit_t); }};
+
+    return {&allocator,
+            [](void* context, ::std::size_t size) -> void* {
+                alloc_t alloc(*static_cast<Allocator*>(context));
+                return ::std::to_address(traits_t::allocate(alloc, count(size)));
+            },
+            [](void* context, void* memory, ::std::size_t size) noexcept -> void {
+                alloc_t alloc(*static_cast<Allocator*>(context));
+                traits_t::deallocate(alloc, static_cast<unit_t*>(memory), count(size));
+            }};
+}
+
+/*!
+ * \brief Functions to start and destroy a type-erased operation state
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ * \internal
+ */
+struct any_op_vtable {
+    auto (*start)(void*) noexcept -> void;
+    auto (*destroy)(void*, const ::beman::execution::detail::any_allocator_ref&) noexcept -> void;
+};
+
+template <typename Op, bool Inline>
+inline constexpr ::beman::execution::detail::any_op_vtable any_op_vtable_for{
+    [](void* op) noexcept -> void { ::beman::execution::start(*static_cast<Op*>(op)); },
+    [](void* op, const ::beman::execution::detail::any_allocator_ref& alloc) noexcept -> void {
+        static_cast<Op*>(op)->~Op();
+        if constexpr (not Inline)
+            alloc.deallocate(alloc.context, op, sizeof(Op));
+    }};
+
+struct any_op_handle {
+    void*                                            op;
+    const ::beman::execution::detail::any_op_vtable* vtable;
+};
+
+/*!
+ * \brief Inline storage for a type-erased operation state
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ * \internal
+ */
+template <::std::size_t Size>
+struct any_op_buffer {
+    static constexpr ::std::size_t size{Size};
+    alignas(::std::max_align_t) ::std::byte data[Size == 0u ? 1u : Size];
+};
+
+/*!
+ * \brief Constructs the operation state returned from `fun()` in `buffer` if it fits and using `alloc` otherwise
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ * \internal
+ */
+template <::std::size_t Size, typename Fun>
+auto any_op_emplace(::beman::execution::detail::any_op_buffer<Size>&     buffer,
+                    const ::beman::execution::detail::any_allocator_ref& alloc,
+                    Fun&& fun) -> ::beman::execution::detail::any_op_handle {
+    using op_t = ::std::remove_cvref_t<decltype(::std::forward<Fun>(fun)())>;
+    static_assert(alignof(op_t) <= alignof(::std::max_align_t), "over-aligned operation states are not supported");
+    if constexpr (sizeof(op_t) <= Size) {
+        op_t* op{::new (static_cast<void*>(buffer.data))
+                     op_t(::beman::execution::detail::emplace_from{::std::forward<Fun>(fun)})};
+        return {op, &::beman::execution::detail::any_op_vtable_for<op_t, true>};
+    } else {
+        void* memory{alloc.allocate(alloc.context, sizeof(op_t))};
+        try {
+            op_t* op{::new (memory) op_t(::beman::execution::detail::emplace_from{::std::forward<Fun>(fun)})};
+            return {op, &::beman::execution::detail::any_op_vtable_for<op_t, false>};
+        } catch (...) {
+            alloc.deallocate(alloc.context, memory, sizeof(op_t));
+            throw;
+        }
+    }
+}
+
+/*!
+ * \brief Operation state owning a receiver and a type-erased operation state connected to it
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ * \internal
+ *
+ * \details
+ * The inner operation state is connected to an `any_receiver_ref` referring
+ * directly to the receiver, i.e., completions only go through one indirect
+ * call. If the inner operation state fits into `Size` bytes it is constructed
+ * in an inline buffer. Otherwise it is allocated using the allocator from the
+ * receiver's environment, falling back to `std::allocator`. The receiver's
+ * stop token is passed on unchanged if it is an `inplace_stop_token`, is
+ * dropped if it is unstoppable, and is otherwise adapted using an
+ * `inplace_stop_source`. The queries `Queries` are forwarded to the
+ * receiver's environment.
+ */
+template <typename Receiver, typename Completions, ::std::size_t Size, typename... Queries>
+class any_operation_state : ::beman::execution::detail::immovable {
+  private:
+    using receiver_ref_t = ::beman::execution::detail::any_receiver_ref<Completions, Queries...>;
+    using token_t =
+        decltype(::beman::execution::get_stop_token(::beman::execution::get_env(::std::declval<const Receiver&>())));
+    using allocator_t = ::std::remove_cvref_t<decltype(::beman::execution::detail::query_with_default(
+        ::beman::execution::get_allocator,
+        ::beman::execution::get_env(::std::declval<const Receiver&>()),
+        ::std::allocator<::std::byte>{}))>;
+    static constexpr bool adapt_token{not ::std::same_as<token_t, ::beman::execution::inplace_stop_token> &&
+                                      not ::beman::execution::unstoppable_token<token_t>};
+
+    struct cb_t {
+        ::beman::execution::inplace_stop_source* source;
+        auto                                     operator()() const noexcept -> void { this->source->request_stop(); }
+    };
+    struct stop_adapter {
+        ::beman::execution::inplace_stop_source                                 source{};
+        ::std::optional<::beman::execution::stop_callback_for_t<token_t, cb_t>> callback{};
+    };
+    struct no_stop_adapter {};
+
+    Receiver                                                                               receiver;
+    [[no_unique_address]] allocator_t                                                      allocator;
+    [[no_unique_address]] ::std::conditional_t<adapt_token, stop_adapter, no_stop_adapter> stop{};
+    ::beman::execution::detail::any_op_buffer<Size>                                        buffer;
+    ::beman::execution::detail::any_op_handle                                              handle;
+
+    auto token() noexcept -> ::beman::execution::inplace_stop_token {
+        if constexpr (adapt_token)
+            return this->stop.source.get_token();
+        else if constexpr (::std::same_as<token_t, ::beman::execution::inplace_stop_token>)
+            return ::beman::execution::get_stop_token(::beman::execution::get_env(this->receiver));
+        else
+            return {};
+    }
+
+  public:
+    using operation_state_concept = ::beman::execution::operation_state_t;
+
+    /*!
+     * \brief Creates the inner operation state by calling `connect(receiver_ref, buffer, alloc)`
+     *
+     * \details
+     * `connect` is expected to use `any_op_emplace` to construct the inner
+     * operation state and to return the resulting handle.
+     */
+    template <typename R, typename Connect>
+    any_operation_state(R&& rcvr, Connect&& connect)
+        : receiver(::std::forward<R>(rcvr)),
+          allocator(::beman::execution::detail::query_with_default(::beman::execution::get_allocator,
+                                                                   ::beman::execution::get_env(this->receiver),
+                                                                   ::std::allocator<::std::byte>{})),
+          handle(::std::forward<Connect>(connect)(
+              receiver_ref_t(this->receiver, this->token()),
+              this->buffer,
+              ::beman::execution::detail::make_any_allocator_ref(this->allocator))) {}
+    ~any_operation_state() {
+        this->handle.vtable->destroy(this->handle.op,
+                                     ::beman::execution::detail::make_any_allocator_ref(this->allocator));
+    }
+
+    auto start() & noexcept -> void {
+        if constexpr (adapt_token)
+            this->stop.callback.emplace(::beman::execution::get_stop_token(::beman::execution::get_env(this->receiver)),
+                                        cb_t{&this->stop.source});
+        this->handle.vtable->start(this->handle.op);
+    }
+};
+} // namespace beman::execution::detail
+
+// ----------------------------------------------------------------------------
+
+#endif
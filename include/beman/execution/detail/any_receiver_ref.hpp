@@ -0,0 +1,178 @@
+// include/beman/execution/detail/any_receiver_ref.hpp              -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef INCLUDED_BEMAN_EXECUTION_DETAIL_ANY_RECEIVER_REF
+#define INCLUDED_BEMAN_EXECUTION_DETAIL_ANY_RECEIVER_REF
+
+#include <beman/execution/detail/completion_signatures.hpp>
+#include <beman/execution/detail/get_env.hpp>
+#include <beman/execution/detail/get_stop_token.hpp>
+#include <beman/execution/detail/inplace_stop_source.hpp>
+#include <beman/execution/detail/receiver.hpp>
+#include <beman/execution/detail/set_error.hpp>
+#include <beman/execution/detail/set_stopped.hpp>
+#include <beman/execution/detail/set_value.hpp>
+
+#include <concepts>
+#include <utility>
+
+// ----------------------------------------------------------------------------
+
+namespace beman::execution::detail {
+/*!
+ * \brief Type-erased entry point for one completion signature
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ * \internal
+ */
+template <typename>
+struct any_completion;
+
+template <typename Tag, typename... A>
+struct any_completion<Tag(A...)> {
+    auto (*complete)(void*, A&&...) noexcept -> void;
+
+    template <typename Receiver>
+    static constexpr auto make() noexcept -> any_completion {
+        return {+[](void* receiver, A&&... a) noexcept -> void {
+            Tag()(::std::move(*static_cast<Receiver*>(receiver)), ::std::forward<A>(a)...);
+        }};
+    }
+    auto operator()(void* receiver, Tag, A&&... a) const noexcept -> void {
+        this->complete(receiver, ::std::forward<A>(a)...);
+    }
+};
+
+/*!
+ * \brief Type-erased entry point answering the environment query `Query` with a `Ret`
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ * \internal
+ */
+template <typename>
+struct any_query;
+
+template <typename Ret, typename Query>
+struct any_query<Ret(Query)> {
+    auto (*query)(const void*) noexcept -> Ret;
+
+    template <typename Receiver>
+    static constexpr auto make() noexcept -> any_query {
+        return {+[](const void* receiver) noexcept -> Ret {
+            return Ret(Query()(::beman::execution::get_env(*static_cast<const Receiver*>(receiver))));
+        }};
+    }
+    auto operator()(const void* receiver, const Query&) const noexcept -> Ret { return this->query(receiver); }
+};
+
+/*!
+ * \brief Determine whether the environment Env can answer the query signature `Ret(Query)`
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ * \internal
+ */
+template <typename, typename>
+inline constexpr bool answers_query{false};
+template <typename Ret, typename Query, typename Env>
+inline constexpr bool answers_query<Ret(Query), Env>{
+    requires(const Env& env) { static_cast<Ret>(Query()(env)); }};
+
+/*!
+ * \brief Table of the completion and query functions of a type-erased receiver
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ * \internal
+ */
+template <typename, typename...>
+struct any_receiver_vtable;
+
+template <typename... Sigs, typename... Queries>
+struct any_receiver_vtable<::beman::execution::completion_signatures<Sigs...>, Queries...>
+    : ::beman::execution::detail::any_completion<Sigs>...,
+      ::beman::execution::detail::any_query<Queries>... {
+    using ::beman::execution::detail::any_completion<Sigs>::operator()...;
+    using ::beman::execution::detail::any_query<Queries>::operator()...;
+
+    template <typename Receiver>
+    static constexpr auto make() noexcept -> any_receiver_vtable {
+        return {::beman::execution::detail::any_completion<Sigs>::template make<Receiver>()...,
+                ::beman::execution::detail::any_query<Queries>::template make<Receiver>()...};
+    }
+};
+
+template <typename Completions, typename Receiver, typename... Queries>
+inline constexpr ::beman::execution::detail::any_receiver_vtable<Completions, Queries...> any_receiver_vtable_for{
+    ::beman::execution::detail::any_receiver_vtable<Completions, Queries...>::template make<Receiver>()};
+
+/*!
+ * \brief Non-owning type-erased receiver accepting the completions `Completions`
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ * \internal
+ *
+ * \details
+ * The object stores a pointer to the actual receiver, a pointer to a table
+ * with one completion function per signature, and the `inplace_stop_token`
+ * exposed through its environment. Completions are dispatched to the entry
+ * whose signature is selected by overload resolution.
+ *
+ * Besides `get_stop_token` the environment only answers the queries listed
+ * as signatures `Ret(Query)` in `Queries`, e.g.,
+ * `std::pmr::polymorphic_allocator<>(get_allocator_t)`: the query is
+ * forwarded to the actual receiver's environment through the table and the
+ * result is converted to `Ret`. The queries are called from a `noexcept`
+ * function, i.e., a conversion to `Ret` which throws terminates the program.
+ * Other queries, e.g., `get_scheduler` or `get_allocator` if they aren't
+ * listed, are not available to the erased sender.
+ */
+template <typename Completions, typename... Queries>
+class any_receiver_ref {
+  private:
+    using vtable_t = ::beman::execution::detail::any_receiver_vtable<Completions, Queries...>;
+
+    void*                                  object;
+    const vtable_t*                        vtable;
+    ::beman::execution::inplace_stop_token token;
+
+  public:
+    using receiver_concept = ::beman::execution::receiver_t;
+
+    struct env {
+        ::beman::execution::inplace_stop_token token;
+        const void*                            object;
+        const vtable_t*                        vtable;
+
+        auto query(const ::beman::execution::get_stop_token_t&) const noexcept
+            -> ::beman::execution::inplace_stop_token {
+            return this->token;
+        }
+        template <typename Query>
+            requires ::std::invocable<const vtable_t&, const void*, const Query&>
+        auto query(const Query& q) const noexcept -> decltype(auto) {
+            return (*this->vtable)(this->object, q);
+        }
+    };
+
+    template <typename Receiver>
+    any_receiver_ref(Receiver& receiver, ::beman::execution::inplace_stop_token tok) noexcept
+        : object(&receiver),
+          vtable(&::beman::execution::detail::any_receiver_vtable_for<Completions, Receiver, Queries...>),
+          token(tok) {}
+
+    template <typename... A>
+        requires ::std::invocable<const vtable_t&, void*, ::beman::execution::set_value_t, A...>
+    auto set_value(A&&... a) && noexcept -> void {
+        (*this->vtable)(this->object, ::beman::execution::set_value_t{}, ::std::forward<A>(a)...);
+    }
+    template <typename E>
+        requires ::std::invocable<const vtable_t&, void*, ::beman::execution::set_error_t, E>
+    auto set_error(E&& e) && noexcept -> void {
+        (*this->vtable)(this->object, ::beman::execution::set_error_t{}, ::std::forward<E>(e));
+    }
+    auto set_stopped() && noexcept -> void
+        requires ::std::invocable<const vtable_t&, void*, ::beman::execution::set_stopped_t>
+    {
+        (*this->vtable)(this->object, ::beman::execution::set_stopped_t{});
+    }
+    auto get_env() const noexcept -> env { return {this->token, this->object, this->vtable}; }
+};
+} // namespace beman::execution::detail
+
+// ----------------------------------------------------------------------------
+
+#endif
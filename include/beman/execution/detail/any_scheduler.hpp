@@ -0,0 +1,244 @@
+// include/beman/execution/detail/any_scheduler.hpp                 -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef INCLUDED_BEMAN_EXECUTION_DETAIL_ANY_SCHEDULER
+#define INCLUDED_BEMAN_EXECUTION_DETAIL_ANY_SCHEDULER
+
+#include <beman/execution/detail/any_operation_state.hpp>
+#include <beman/execution/detail/any_receiver_ref.hpp>
+#include <beman/execution/detail/completion_signatures.hpp>
+#include <beman/execution/detail/completion_signatures_of_t.hpp>
+#include <beman/execution/detail/connect.hpp>
+#include <beman/execution/detail/default_domain.hpp>
+#include <beman/execution/detail/get_completion_scheduler.hpp>
+#include <beman/execution/detail/get_domain.hpp>
+#include <beman/execution/detail/receiver.hpp>
+#include <beman/execution/detail/receiver_of.hpp>
+#include <beman/execution/detail/schedule.hpp>
+#include <beman/execution/detail/schedule_result_t.hpp>
+#include <beman/execution/detail/scheduler.hpp>
+#include <beman/execution/detail/sender.hpp>
+#include <beman/execution/detail/set_error.hpp>
+#include <beman/execution/detail/set_stopped.hpp>
+#include <beman/execution/detail/set_value.hpp>
+
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <exception>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// ----------------------------------------------------------------------------
+
+namespace beman::execution {
+class any_scheduler;
+}
+
+// ----------------------------------------------------------------------------
+
+/*!
+ * \brief Type-erased scheduler
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ *
+ * \details
+ * Schedulers of at most `scheduler_size` bytes which are nothrow copy and
+ * move constructible are stored inline, other schedulers are allocated once
+ * and shared by reference count between copies, i.e., copying an
+ * `any_scheduler` never allocates or throws. The
+ * operation state resulting from connecting the erased scheduler's
+ * `schedule()` sender is constructed into an inline buffer of `state_size`
+ * bytes, i.e., scheduling on typical schedulers doesn't allocate. Larger
+ * operation states are allocated using the receiver's allocator. The
+ * environment of the `schedule()` sender yields the `any_scheduler` as
+ * completion scheduler. As domains are static properties, `get_domain` yields
+ * the `default_domain` while the erased scheduler's domain still gets applied
+ * when its `schedule()` sender is connected.
+ */
+class beman::execution::any_scheduler {
+  public:
+    using scheduler_concept = ::beman::execution::scheduler_t;
+    using completion_signatures =
+        ::beman::execution::completion_signatures<::beman::execution::set_value_t(),
+                                                  ::beman::execution::set_error_t(::std::exception_ptr),
+                                                  ::beman::execution::set_stopped_t()>;
+    static constexpr ::std::size_t scheduler_size{2u * sizeof(void*)};
+    static constexpr ::std::size_t state_size{16u * sizeof(void*)};
+
+  private:
+    using receiver_ref_t = ::beman::execution::detail::any_receiver_ref<completion_signatures>;
+    using op_buffer_t    = ::beman::execution::detail::any_op_buffer<state_size>;
+
+    struct env;
+    struct sender;
+
+    struct vtable {
+        auto (*copy)(const void*, void*) noexcept -> void;
+        auto (*move)(void*, void*) noexcept -> void;
+        auto (*destroy)(void*) noexcept -> void;
+        auto (*equal)(const void*, const void*) noexcept -> bool;
+        auto (*connect)(const void*,
+                        receiver_ref_t,
+                        op_buffer_t&,
+                        const ::beman::execution::detail::any_allocator_ref&)
+            -> ::beman::execution::detail::any_op_handle;
+    };
+
+    template <typename Scheduler>
+    struct shared_box {
+        ::std::atomic<::std::size_t> count{1u};
+        Scheduler                    sched;
+    };
+
+    template <typename Scheduler>
+    static constexpr bool is_inline{sizeof(Scheduler) <= scheduler_size &&
+                                    alignof(Scheduler) <= alignof(::std::max_align_t) &&
+                                    ::std::is_nothrow_copy_constructible_v<Scheduler> &&
+                                    ::std::is_nothrow_move_constructible_v<Scheduler>};
+
+    template <typename Scheduler>
+    static auto object(const void* storage) noexcept -> const Scheduler* {
+        if constexpr (is_inline<Scheduler>)
+            return static_cast<const Scheduler*>(storage);
+        else
+            return &(*static_cast<shared_box<Scheduler>* const*>(storage))->sched;
+    }
+
+    template <typename Scheduler>
+    static constexpr vtable vtable_for{
+        [](const void* from, void* to) noexcept -> void {
+            if constexpr (is_inline<Scheduler>) {
+                ::new (to) Scheduler(*object<Scheduler>(from));
+            } else {
+                auto* box{*static_cast<shared_box<Scheduler>* const*>(from)};
+                box->count.fetch_add(1u, ::std::memory_order_relaxed);
+                ::new (to) shared_box<Scheduler>*(box);
+            }
+        },
+        [](void* from, void* to) noexcept -> void {
+            if constexpr (is_inline<Scheduler>) {
+                ::new (to) Scheduler(::std::move(*static_cast<Scheduler*>(from)));
+                static_cast<Scheduler*>(from)->~Scheduler();
+            } else {
+                ::new (to) shared_box<Scheduler>*(*static_cast<shared_box<Scheduler>**>(from));
+            }
+        },
+        [](void* storage) noexcept -> void {
+            if constexpr (is_inline<Scheduler>) {
+                static_cast<Scheduler*>(storage)->~Scheduler();
+            } else {
+                auto* box{*static_cast<shared_box<Scheduler>**>(storage)};
+                if (box->count.fetch_sub(1u, ::std::memory_order_acq_rel) == 1u)
+                    delete box;
+            }
+        },
+        [](const void* s0, const void* s1) noexcept -> bool {
+            return *object<Scheduler>(s0) == *object<Scheduler>(s1);
+        },
+        [](const void*                                          storage,
+           receiver_ref_t                                       receiver,
+           op_buffer_t&                                         buffer,
+           const ::beman::execution::detail::any_allocator_ref& alloc) -> ::beman::execution::detail::any_op_handle {
+            return ::beman::execution::detail::any_op_emplace(buffer, alloc, [storage, &receiver] {
+                return ::beman::execution::connect(::beman::execution::schedule(Scheduler(*object<Scheduler>(storage))),
+                                                   ::std::move(receiver));
+            });
+        }};
+
+    alignas(::std::max_align_t) ::std::byte storage[scheduler_size];
+    const vtable* vtbl{};
+
+  public:
+    template <typename Scheduler>
+        requires(not ::std::same_as<::std::remove_cvref_t<Scheduler>, any_scheduler>) &&
+                ::beman::execution::scheduler<Scheduler> &&
+                ::beman::execution::receiver_of<
+                    receiver_ref_t,
+                    ::beman::execution::completion_signatures_of_t<
+                        ::beman::execution::schedule_result_t<::std::remove_cvref_t<Scheduler>>,
+                        typename receiver_ref_t::env>>
+    any_scheduler(Scheduler&& sched) : vtbl(&vtable_for<::std::remove_cvref_t<Scheduler>>) {
+        using scheduler_t = ::std::remove_cvref_t<Scheduler>;
+        if constexpr (is_inline<scheduler_t>)
+            ::new (static_cast<void*>(this->storage)) scheduler_t(::std::forward<Scheduler>(sched));
+        else
+            ::new (static_cast<void*>(this->storage))
+                shared_box<scheduler_t>*(new shared_box<scheduler_t>{{1u}, ::std::forward<Scheduler>(sched)});
+    }
+    any_scheduler(const any_scheduler& other) noexcept : vtbl(other.vtbl) {
+        if (this->vtbl)
+            this->vtbl->copy(other.storage, this->storage);
+    }
+    any_scheduler(any_scheduler&& other) noexcept : vtbl(::std::exchange(other.vtbl, nullptr)) {
+        if (this->vtbl)
+            this->vtbl->move(other.storage, this->storage);
+    }
+    ~any_scheduler() { this->reset(); }
+    auto operator=(const any_scheduler& other) noexcept -> any_scheduler& {
+        if (this != &other)
+            *this = any_scheduler(other);
+        return *this;
+    }
+    auto operator=(any_scheduler&& other) noexcept -> any_scheduler& {
+        if (this != &other) {
+            this->reset();
+            if ((this->vtbl = ::std::exchange(other.vtbl, nullptr)))
+                this->vtbl->move(other.storage, this->storage);
+        }
+        return *this;
+    }
+
+    auto schedule() const -> sender;
+    auto query(const ::beman::execution::get_domain_t&) const noexcept -> ::beman::execution::default_domain {
+        return {};
+    }
+    auto operator==(const any_scheduler& other) const noexcept -> bool {
+        return this->vtbl == other.vtbl && (this->vtbl == nullptr || this->vtbl->equal(this->storage, other.storage));
+    }
+
+  private:
+    auto reset() noexcept -> void {
+        if (auto* v{::std::exchange(this->vtbl, nullptr)})
+            v->destroy(this->storage);
+    }
+};
+
+struct beman::execution::any_scheduler::env {
+    const ::beman::execution::any_scheduler* sched;
+
+    template <typename Tag>
+    auto query(const ::beman::execution::get_completion_scheduler_t<Tag>&) const noexcept
+        -> ::beman::execution::any_scheduler {
+        return *this->sched;
+    }
+    auto query(const ::beman::execution::get_domain_t&) const noexcept -> ::beman::execution::default_domain {
+        return {};
+    }
+};
+
+struct beman::execution::any_scheduler::sender {
+    using sender_concept        = ::beman::execution::sender_t;
+    using completion_signatures = ::beman::execution::any_scheduler::completion_signatures;
+
+    ::beman::execution::any_scheduler sched;
+
+    auto get_env() const noexcept -> env { return {&this->sched}; }
+    template <::beman::execution::receiver Receiver>
+    auto connect(Receiver&& receiver) const
+        -> ::beman::execution::detail::
+            any_operation_state<::std::remove_cvref_t<Receiver>, completion_signatures, any_scheduler::state_size> {
+        return {::std::forward<Receiver>(receiver),
+                [this](receiver_ref_t                                       r,
+                       op_buffer_t&                                         buffer,
+                       const ::beman::execution::detail::any_allocator_ref& alloc) {
+                    return this->sched.vtbl->connect(this->sched.storage, ::std::move(r), buffer, alloc);
+                }};
+    }
+};
+
+inline auto beman::execution::any_scheduler::schedule() const -> sender { return {*this}; }
+
+// ----------------------------------------------------------------------------
+
+#endif
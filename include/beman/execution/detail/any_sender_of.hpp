@@ -0,0 +1,161 @@
+// include/beman/execution/detail/any_sender_of.hpp                 -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef INCLUDED_BEMAN_EXECUTION_DETAIL_ANY_SENDER_OF
+#define INCLUDED_BEMAN_EXECUTION_DETAIL_ANY_SENDER_OF
+
+#include <beman/execution/detail/any_operation_state.hpp>
+#include <beman/execution/detail/any_receiver_ref.hpp>
+#include <beman/execution/detail/completion_signatures.hpp>
+#include <beman/execution/detail/connect.hpp>
+#include <beman/execution/detail/completion_signatures_of_t.hpp>
+#include <beman/execution/detail/env_of_t.hpp>
+#include <beman/execution/detail/receiver.hpp>
+#include <beman/execution/detail/receiver_of.hpp>
+#include <beman/execution/detail/sender.hpp>
+#include <beman/execution/detail/sender_in.hpp>
+
+#include <concepts>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// ----------------------------------------------------------------------------
+
+namespace beman::execution {
+template <typename Completions,
+          ::std::size_t SenderSize = 4u * sizeof(void*),
+          ::std::size_t StateSize  = 16u * sizeof(void*),
+          typename... Queries>
+class any_sender_of;
+}
+
+// ----------------------------------------------------------------------------
+
+/*!
+ * \brief Move-only type-erased sender with the completions `completion_signatures<Sigs...>`
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ *
+ * \details
+ * A sender of at most `SenderSize` bytes which is nothrow move constructible
+ * is stored inline, larger senders are allocated. When connected, the erased
+ * sender's operation state is constructed into an inline buffer of
+ * `StateSize` bytes within the resulting operation state or, if it doesn't
+ * fit, allocated using `get_allocator(get_env(receiver))`, falling back to
+ * `std::allocator`. The erased receiver's environment provides an
+ * `inplace_stop_token` linked to the receiver's stop token. Other queries
+ * are only answered if they are listed as signatures `Ret(Query)` in
+ * `Queries`, e.g., `any_scheduler(get_scheduler_t)`: these are forwarded to
+ * the receiver's environment and their result is converted to `Ret`. Only
+ * receivers whose environment answers all of `Queries` can be connected.
+ * Connecting a moved-from `any_sender_of` is undefined behavior.
+ */
+template <typename... Sigs, ::std::size_t SenderSize, ::std::size_t StateSize, typename... Queries>
+class beman::execution::
+    any_sender_of<::beman::execution::completion_signatures<Sigs...>, SenderSize, StateSize, Queries...> {
+  public:
+    using sender_concept        = ::beman::execution::sender_t;
+    using completion_signatures = ::beman::execution::completion_signatures<Sigs...>;
+
+  private:
+    using receiver_ref_t = ::beman::execution::detail::any_receiver_ref<completion_signatures, Queries...>;
+    using op_buffer_t    = ::beman::execution::detail::any_op_buffer<StateSize>;
+
+    struct vtable {
+        auto (*move)(void*, void*) noexcept -> void;
+        auto (*destroy)(void*) noexcept -> void;
+        auto (*connect)(void*, receiver_ref_t, op_buffer_t&, const ::beman::execution::detail::any_allocator_ref&)
+            -> ::beman::execution::detail::any_op_handle;
+    };
+
+    template <typename Sender>
+    static constexpr bool is_inline{sizeof(Sender) <= SenderSize && alignof(Sender) <= alignof(::std::max_align_t) &&
+                                    ::std::is_nothrow_move_constructible_v<Sender>};
+
+    template <typename Sender>
+    static auto object(void* storage) noexcept -> Sender* {
+        if constexpr (is_inline<Sender>)
+            return static_cast<Sender*>(storage);
+        else
+            return *static_cast<Sender**>(storage);
+    }
+
+    template <typename Sender>
+    static constexpr vtable vtable_for{
+        [](void* from, void* to) noexcept -> void {
+            if constexpr (is_inline<Sender>) {
+                ::new (to) Sender(::std::move(*object<Sender>(from)));
+                object<Sender>(from)->~Sender();
+            } else {
+                ::new (to) Sender*(object<Sender>(from));
+            }
+        },
+        [](void* storage) noexcept -> void {
+            if constexpr (is_inline<Sender>)
+                object<Sender>(storage)->~Sender();
+            else
+                delete object<Sender>(storage);
+        },
+        [](void*                                                storage,
+           receiver_ref_t                                       receiver,
+           op_buffer_t&                                         buffer,
+           const ::beman::execution::detail::any_allocator_ref& alloc) -> ::beman::execution::detail::any_op_handle {
+            return ::beman::execution::detail::any_op_emplace(buffer, alloc, [storage, &receiver] {
+                return ::beman::execution::connect(::std::move(*object<Sender>(storage)), ::std::move(receiver));
+            });
+        }};
+
+    alignas(::std::max_align_t) ::std::byte storage[SenderSize < sizeof(void*) ? sizeof(void*) : SenderSize];
+    const vtable* vtbl{};
+
+  public:
+    template <typename Sender>
+        requires(not ::std::same_as<::std::remove_cvref_t<Sender>, any_sender_of>) &&
+                ::beman::execution::sender_in<Sender, typename receiver_ref_t::env> &&
+                ::beman::execution::receiver_of<
+                    receiver_ref_t,
+                    ::beman::execution::completion_signatures_of_t<Sender, typename receiver_ref_t::env>>
+    any_sender_of(Sender&& sndr) : vtbl(&vtable_for<::std::remove_cvref_t<Sender>>) {
+        using sender_t = ::std::remove_cvref_t<Sender>;
+        if constexpr (is_inline<sender_t>)
+            ::new (static_cast<void*>(this->storage)) sender_t(::std::forward<Sender>(sndr));
+        else
+            ::new (static_cast<void*>(this->storage)) sender_t*(new sender_t(::std::forward<Sender>(sndr)));
+    }
+    any_sender_of(any_sender_of&& other) noexcept : vtbl(::std::exchange(other.vtbl, nullptr)) {
+        if (this->vtbl)
+            this->vtbl->move(other.storage, this->storage);
+    }
+    ~any_sender_of() { this->reset(); }
+    auto operator=(any_sender_of&& other) noexcept -> any_sender_of& {
+        if (this != &other) {
+            this->reset();
+            if ((this->vtbl = ::std::exchange(other.vtbl, nullptr)))
+                this->vtbl->move(other.storage, this->storage);
+        }
+        return *this;
+    }
+
+    template <::beman::execution::receiver Receiver>
+        requires(::beman::execution::detail::answers_query<Queries, ::beman::execution::env_of_t<Receiver>> && ...)
+    auto connect(Receiver&& receiver) && -> ::beman::execution::detail::
+        any_operation_state<::std::remove_cvref_t<Receiver>, completion_signatures, StateSize, Queries...> {
+        return {::std::forward<Receiver>(receiver),
+                [this](receiver_ref_t                                       r,
+                       op_buffer_t&                                         buffer,
+                       const ::beman::execution::detail::any_allocator_ref& alloc) {
+                    return this->vtbl->connect(this->storage, ::std::move(r), buffer, alloc);
+                }};
+    }
+
+  private:
+    auto reset() noexcept -> void {
+        if (auto* v{::std::exchange(this->vtbl, nullptr)})
+            v->destroy(this->storage);
+    }
+};
+
+// ----------------------------------------------------------------------------
+
+#endif
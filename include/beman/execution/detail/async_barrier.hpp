@@ -0,0 +1,97 @@
+// include/beman/execution/detail/async_barrier.hpp                 -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef INCLUDED_BEMAN_EXECUTION_DETAIL_ASYNC_BARRIER
+#define INCLUDED_BEMAN_EXECUTION_DETAIL_ASYNC_BARRIER
+
+#include <beman/execution/detail/async_waiters.hpp>
+#include <beman/execution/detail/sender.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+// ----------------------------------------------------------------------------
+
+namespace beman::execution {
+/*!
+ * \brief Reusable phase barrier whose waiting operation is a sender
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ *
+ * \details
+ * Each phase completes once the expected number of arrivals was counted.
+ * The sender returned from `arrive_and_wait()` arrives when it is started and
+ * completes with `set_value()` on the thread of the last arrival of the
+ * phase, in the order the operations started. Then the barrier is reset for
+ * the next phase. `arrive_and_drop()` also reduces the expected number of
+ * arrivals for all subsequent phases. Arrivals only use atomic operations and
+ * the waiting operations are linked into a lock-free stack, i.e., any number
+ * of operations can wait on a phase without parking threads or taking locks.
+ * Like for `std::barrier`, more arrivals in a phase than expected are
+ * undefined behavior.
+ */
+class async_barrier {
+  private:
+    template <typename Receiver>
+    struct opstate : ::beman::execution::detail::async_waiter_state<Receiver> {
+        async_barrier* barrier;
+
+        template <typename R>
+        opstate(async_barrier* b, R&& rcvr)
+            : ::beman::execution::detail::async_waiter_state<Receiver>(::std::forward<R>(rcvr)), barrier(b) {}
+
+        auto start() & noexcept -> void {
+            // the operation may complete before arrive() returns
+            auto* b{this->barrier};
+            b->waiters.try_push(this);
+            b->arrive(1);
+        }
+    };
+
+    ::std::atomic<::std::ptrdiff_t>                expected;
+    ::std::atomic<::std::ptrdiff_t>                remaining;
+    ::beman::execution::detail::async_waiter_stack waiters{};
+
+  public:
+    class sender {
+      public:
+        using sender_concept        = ::beman::execution::sender_t;
+        using completion_signatures = ::beman::execution::detail::async_waiter_signatures;
+
+        explicit sender(async_barrier* b) noexcept : barrier(b) {}
+
+        template <typename Receiver>
+        auto connect(Receiver&& receiver) const
+            noexcept(::std::is_nothrow_constructible_v<::std::decay_t<Receiver>, Receiver>)
+                -> opstate<::std::decay_t<Receiver>> {
+            return {this->barrier, ::std::forward<Receiver>(receiver)};
+        }
+
+      private:
+        async_barrier* barrier;
+    };
+
+    explicit async_barrier(::std::ptrdiff_t count) noexcept : expected(count), remaining(count) {}
+
+    //! Counts `n` arrivals without waiting; the last arrival completes the phase.
+    auto arrive(::std::ptrdiff_t n = 1) noexcept -> void {
+        if (this->remaining.fetch_sub(n, ::std::memory_order_acq_rel) != n)
+            return;
+        // the waiters may destroy the barrier: reset it before completing them
+        auto waiters{this->waiters.pop_all()};
+        this->remaining.store(this->expected.load(::std::memory_order_relaxed), ::std::memory_order_release);
+        ::beman::execution::detail::notify_waiters(::std::move(waiters));
+    }
+    auto arrive_and_wait() noexcept -> sender { return sender{this}; }
+    //! Arrives and reduces the expected number of arrivals of subsequent phases by one.
+    auto arrive_and_drop() noexcept -> void {
+        this->expected.fetch_sub(1, ::std::memory_order_relaxed);
+        this->arrive(1);
+    }
+};
+} // namespace beman::execution
+
+// ----------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,222 @@
+// include/beman/execution/detail/async_channel.hpp                 -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef INCLUDED_BEMAN_EXECUTION_DETAIL_ASYNC_CHANNEL
+#define INCLUDED_BEMAN_EXECUTION_DETAIL_ASYNC_CHANNEL
+
+#include <beman/execution/detail/async_semaphore.hpp>
+#include <beman/execution/detail/completion_signatures.hpp>
+#include <beman/execution/detail/connect.hpp>
+#include <beman/execution/detail/connect_result_t.hpp>
+#include <beman/execution/detail/fwd_env.hpp>
+#include <beman/execution/detail/get_env.hpp>
+#include <beman/execution/detail/immovable.hpp>
+#include <beman/execution/detail/operation_state.hpp>
+#include <beman/execution/detail/receiver.hpp>
+#include <beman/execution/detail/sender.hpp>
+#include <beman/execution/detail/set_stopped.hpp>
+#include <beman/execution/detail/set_value.hpp>
+#include <beman/execution/detail/start.hpp>
+
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+// ----------------------------------------------------------------------------
+
+namespace beman::execution {
+template <typename T>
+class async_channel;
+}
+
+// ----------------------------------------------------------------------------
+
+/*!
+ * \brief Bounded multi-producer/multi-consumer channel with sender-based `send()` and `receive()`
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ *
+ * \details
+ * Messages are stored in a ring buffer of `capacity` slots allocated once on
+ * construction. Access to the ring is guarded by two `async_semaphore`s
+ * counting the free slots and the stored messages: a `send(value)` operation
+ * first acquires a free slot and a `receive()` operation first acquires a
+ * message. Acquiring doesn't lock when a unit is available. Otherwise the
+ * operation is suspended in an intrusive FIFO waiter list, i.e., producers
+ * of a full channel and consumers of an empty channel wait without blocking
+ * a thread and without allocating. Slots are claimed using atomic tickets
+ * and a per-slot turn counter orders concurrent producers and consumers
+ * lapping each other. A suspended operation whose receiver's stop token gets
+ * triggered completes with `set_stopped()` without sending or receiving.
+ */
+template <typename T>
+class beman::execution::async_channel : ::beman::execution::detail::immovable {
+    static_assert(::std::is_nothrow_move_constructible_v<T>, "the channel's value type needs a noexcept move");
+
+  private:
+    struct slot {
+        ::std::atomic<::std::size_t> turn{};
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        auto value() noexcept -> T* { return ::std::launder(reinterpret_cast<T*>(this->storage)); }
+    };
+
+    auto push(T&& value) noexcept -> void {
+        ::std::size_t ticket{this->tail.fetch_add(1u, ::std::memory_order_relaxed)};
+        slot&         s{this->slots[ticket % this->capacity_]};
+        ::std::size_t turn{2u * (ticket / this->capacity_)};
+        while (s.turn.load(::std::memory_order_acquire) != turn)
+            ::std::this_thread::yield();
+        ::new (static_cast<void*>(s.storage)) T(::std::move(value));
+        s.turn.store(turn + 1u, ::std::memory_order_release);
+        this->items.release();
+    }
+    auto pop() noexcept -> T {
+        ::std::size_t ticket{this->head.fetch_add(1u, ::std::memory_order_relaxed)};
+        slot&         s{this->slots[ticket % this->capacity_]};
+        ::std::size_t turn{2u * (ticket / this->capacity_) + 1u};
+        while (s.turn.load(::std::memory_order_acquire) != turn)
+            ::std::this_thread::yield();
+        T rc(::std::move(*s.value()));
+        s.value()->~T();
+        s.turn.store(turn + 1u, ::std::memory_order_release);
+        this->free.release();
+        return rc;
+    }
+
+    template <typename Receiver>
+    struct send_state;
+    template <typename Receiver>
+    struct receive_state;
+    struct send_sender;
+    struct receive_sender;
+
+    ::std::size_t                               capacity_;
+    ::std::unique_ptr<slot[]>                   slots;
+    ::std::atomic<::std::size_t>                head{};
+    ::std::atomic<::std::size_t>                tail{};
+    ::beman::execution::detail::async_semaphore free;
+    ::beman::execution::detail::async_semaphore items{0};
+
+  public:
+    explicit async_channel(::std::size_t capacity)
+        : capacity_(capacity < 1u ? 1u : capacity),
+          slots(new slot[this->capacity_]),
+          free(static_cast<::std::ptrdiff_t>(this->capacity_)) {}
+    ~async_channel() {
+        for (::std::size_t i{}; i != this->capacity_; ++i)
+            if (this->slots[i].turn.load(::std::memory_order_relaxed) % 2u == 1u)
+                this->slots[i].value()->~T();
+    }
+
+    auto capacity() const noexcept -> ::std::size_t { return this->capacity_; }
+    auto send(T value) noexcept -> send_sender { return {this, ::std::move(value)}; }
+    auto receive() noexcept -> receive_sender { return {this}; }
+};
+
+template <typename T>
+template <typename Receiver>
+struct beman::execution::async_channel<T>::send_state {
+    using operation_state_concept = ::beman::execution::operation_state_t;
+
+    struct acquired {
+        using receiver_concept = ::beman::execution::receiver_t;
+        send_state* st;
+
+        auto set_value() && noexcept -> void {
+            this->st->channel->push(::std::move(this->st->value));
+            ::beman::execution::set_value(::std::move(this->st->receiver));
+        }
+        auto set_stopped() && noexcept -> void { ::beman::execution::set_stopped(::std::move(this->st->receiver)); }
+        auto get_env() const noexcept {
+            return ::beman::execution::detail::fwd_env(::beman::execution::get_env(this->st->receiver));
+        }
+    };
+
+    async_channel*                                                                                      channel;
+    T                                                                                                   value;
+    Receiver                                                                                            receiver;
+    ::beman::execution::connect_result_t<::beman::execution::detail::async_semaphore::sender, acquired> op;
+
+    template <typename R>
+    send_state(async_channel* ch, T&& val, R&& rcvr)
+        : channel(ch),
+          value(::std::move(val)),
+          receiver(::std::forward<R>(rcvr)),
+          op(::beman::execution::connect(ch->free.acquire(), acquired{this})) {}
+    auto start() & noexcept -> void { ::beman::execution::start(this->op); }
+};
+
+template <typename T>
+template <typename Receiver>
+struct beman::execution::async_channel<T>::receive_state {
+    using operation_state_concept = ::beman::execution::operation_state_t;
+
+    struct acquired {
+        using receiver_concept = ::beman::execution::receiver_t;
+        receive_state* st;
+
+        auto set_value() && noexcept -> void {
+            ::beman::execution::set_value(::std::move(this->st->receiver), this->st->channel->pop());
+        }
+        auto set_stopped() && noexcept -> void { ::beman::execution::set_stopped(::std::move(this->st->receiver)); }
+        auto get_env() const noexcept {
+            return ::beman::execution::detail::fwd_env(::beman::execution::get_env(this->st->receiver));
+        }
+    };
+
+    async_channel*                                                                                      channel;
+    Receiver                                                                                            receiver;
+    ::beman::execution::connect_result_t<::beman::execution::detail::async_semaphore::sender, acquired> op;
+
+    template <typename R>
+    receive_state(async_channel* ch, R&& rcvr)
+        : channel(ch),
+          receiver(::std::forward<R>(rcvr)),
+          op(::beman::execution::connect(ch->items.acquire(), acquired{this})) {}
+    auto start() & noexcept -> void { ::beman::execution::start(this->op); }
+};
+
+template <typename T>
+struct beman::execution::async_channel<T>::send_sender {
+    using sender_concept = ::beman::execution::sender_t;
+    using completion_signatures =
+        ::beman::execution::completion_signatures<::beman::execution::set_value_t(),
+                                                  ::beman::execution::set_stopped_t()>;
+
+    async_channel* channel;
+    T              value;
+
+    template <::beman::execution::receiver Receiver>
+    auto connect(Receiver&& receiver) && -> send_state<::std::remove_cvref_t<Receiver>> {
+        return {this->channel, ::std::move(this->value), ::std::forward<Receiver>(receiver)};
+    }
+    template <::beman::execution::receiver Receiver>
+        requires ::std::copy_constructible<T>
+    auto connect(Receiver&& receiver) const& -> send_state<::std::remove_cvref_t<Receiver>> {
+        return {this->channel, T(this->value), ::std::forward<Receiver>(receiver)};
+    }
+};
+
+template <typename T>
+struct beman::execution::async_channel<T>::receive_sender {
+    using sender_concept = ::beman::execution::sender_t;
+    using completion_signatures =
+        ::beman::execution::completion_signatures<::beman::execution::set_value_t(T),
+                                                  ::beman::execution::set_stopped_t()>;
+
+    async_channel* channel;
+
+    template <::beman::execution::receiver Receiver>
+    auto connect(Receiver&& receiver) const -> receive_state<::std::remove_cvref_t<Receiver>> {
+        return {this->channel, ::std::forward<Receiver>(receiver)};
+    }
+};
+
+// ----------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,99 @@
+// include/beman/execution/detail/async_latch.hpp                   -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef INCLUDED_BEMAN_EXECUTION_DETAIL_ASYNC_LATCH
+#define INCLUDED_BEMAN_EXECUTION_DETAIL_ASYNC_LATCH
+
+#include <beman/execution/detail/async_manual_reset_event.hpp>
+#include <beman/execution/detail/async_waiters.hpp>
+#include <beman/execution/detail/connect.hpp>
+#include <beman/execution/detail/connect_result_t.hpp>
+#include <beman/execution/detail/immovable.hpp>
+#include <beman/execution/detail/operation_state.hpp>
+#include <beman/execution/detail/sender.hpp>
+#include <beman/execution/detail/start.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+// ----------------------------------------------------------------------------
+
+namespace beman::execution {
+/*!
+ * \brief Single-use count down latch whose waiting operation is a sender
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ *
+ * \details
+ * The senders returned from `wait()` and `arrive_and_wait()` complete with
+ * `set_value()` once the counter reached zero: inline from `start()` if it
+ * already is zero or on the thread whose `count_down()` reached zero. The
+ * counter is an atomic and the waiting operations are linked into the
+ * lock-free stack of an `async_manual_reset_event`. Like for `std::latch`,
+ * counting down below zero is undefined behavior.
+ */
+class async_latch {
+  private:
+    template <typename Receiver>
+    struct opstate : ::beman::execution::detail::immovable {
+        using operation_state_concept = ::beman::execution::operation_state_t;
+        using wait_t = ::beman::execution::connect_result_t<::beman::execution::async_manual_reset_event::sender,
+                                                            Receiver>;
+
+        async_latch*     latch;
+        ::std::ptrdiff_t update;
+        wait_t           wait;
+
+        template <typename R>
+        opstate(async_latch* l, ::std::ptrdiff_t n, R&& rcvr)
+            : latch(l), update(n), wait(::beman::execution::connect(l->event.wait(), ::std::forward<R>(rcvr))) {}
+
+        auto start() & noexcept -> void {
+            // the operation may complete before count_down() returns
+            auto* l{this->latch};
+            auto  n{this->update};
+            ::beman::execution::start(this->wait);
+            l->count_down(n);
+        }
+    };
+
+    ::std::atomic<::std::ptrdiff_t>              count;
+    ::beman::execution::async_manual_reset_event event;
+
+  public:
+    using sender = ::beman::execution::async_manual_reset_event::sender;
+    class arrive_sender {
+      public:
+        using sender_concept        = ::beman::execution::sender_t;
+        using completion_signatures = ::beman::execution::detail::async_waiter_signatures;
+
+        template <typename Receiver>
+        auto connect(Receiver&& receiver) const -> opstate<::std::decay_t<Receiver>> {
+            return {this->latch, this->update, ::std::forward<Receiver>(receiver)};
+        }
+
+      private:
+        friend class async_latch;
+        arrive_sender(async_latch* l, ::std::ptrdiff_t n) noexcept : latch(l), update(n) {}
+
+        async_latch*     latch;
+        ::std::ptrdiff_t update;
+    };
+
+    explicit async_latch(::std::ptrdiff_t expected) noexcept : count(expected), event(expected == 0) {}
+
+    auto count_down(::std::ptrdiff_t n = 1) noexcept -> void {
+        if (this->count.fetch_sub(n, ::std::memory_order_acq_rel) == n)
+            this->event.set();
+    }
+    auto try_wait() const noexcept -> bool { return this->count.load(::std::memory_order_acquire) == 0; }
+    auto wait() noexcept -> sender { return this->event.wait(); }
+    //! Counts down by `n` once started and completes when the counter reached zero.
+    auto arrive_and_wait(::std::ptrdiff_t n = 1) noexcept -> arrive_sender { return arrive_sender(this, n); }
+};
+} // namespace beman::execution
+
+// ----------------------------------------------------------------------------
+
+#endif
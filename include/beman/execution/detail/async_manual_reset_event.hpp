@@ -0,0 +1,86 @@
+// include/beman/execution/detail/async_manual_reset_event.hpp      -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef INCLUDED_BEMAN_EXECUTION_DETAIL_ASYNC_MANUAL_RESET_EVENT
+#define INCLUDED_BEMAN_EXECUTION_DETAIL_ASYNC_MANUAL_RESET_EVENT
+
+#include <beman/execution/detail/async_waiters.hpp>
+#include <beman/execution/detail/sender.hpp>
+#include <beman/execution/detail/set_value.hpp>
+
+#include <type_traits>
+#include <utility>
+
+// ----------------------------------------------------------------------------
+
+namespace beman::execution {
+/*!
+ * \brief Event whose waiting operation is a sender
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ *
+ * \details
+ * The sender returned from `wait()` completes with `set_value()` once the
+ * event is set: inline from `start()` if the event is already set or on the
+ * thread calling `set()` otherwise, in the order the operations started.
+ * The event stays set until `reset()` is called. The waiting operations are
+ * linked into a lock-free stack whose closed state represents the set event,
+ * i.e., neither waiting nor setting the event takes a lock or allocates.
+ * Waiting operations are not cancellable: they only complete once the event
+ * is set.
+ */
+class async_manual_reset_event {
+  private:
+    template <typename Receiver>
+    struct opstate : ::beman::execution::detail::async_waiter_state<Receiver> {
+        async_manual_reset_event* event;
+
+        template <typename R>
+        opstate(async_manual_reset_event* e, R&& rcvr)
+            : ::beman::execution::detail::async_waiter_state<Receiver>(::std::forward<R>(rcvr)), event(e) {}
+
+        auto start() & noexcept -> void {
+            if (not this->event->waiters.try_push(this))
+                ::beman::execution::set_value(::std::move(this->receiver));
+        }
+    };
+
+    ::beman::execution::detail::async_waiter_stack waiters{};
+
+  public:
+    class sender {
+      public:
+        using sender_concept        = ::beman::execution::sender_t;
+        using completion_signatures = ::beman::execution::detail::async_waiter_signatures;
+
+        explicit sender(async_manual_reset_event* e) noexcept : event(e) {}
+
+        template <typename Receiver>
+        auto connect(Receiver&& receiver) const
+            noexcept(::std::is_nothrow_constructible_v<::std::decay_t<Receiver>, Receiver>)
+                -> opstate<::std::decay_t<Receiver>> {
+            return {this->event, ::std::forward<Receiver>(receiver)};
+        }
+
+      private:
+        async_manual_reset_event* event;
+    };
+
+    explicit async_manual_reset_event(bool initially_set = false) noexcept {
+        if (initially_set)
+            this->set();
+    }
+
+    //! Sets the event, completing all waiting operations on the calling thread.
+    auto set() noexcept -> void {
+        ::beman::execution::detail::notify_waiters(this->waiters.pop_all_and_shutdown());
+    }
+    //! Resets a set event; operations started afterwards wait for the next `set()`.
+    auto reset() noexcept -> void { this->waiters.try_reopen(); }
+    auto is_set() const noexcept -> bool { return this->waiters.is_shutdown(); }
+    auto wait() noexcept -> sender { return sender{this}; }
+};
+} // namespace beman::execution
+
+// ----------------------------------------------------------------------------
+
+#endif
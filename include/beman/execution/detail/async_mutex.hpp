@@ -0,0 +1,39 @@
+// include/beman/execution/detail/async_mutex.hpp                   -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef INCLUDED_BEMAN_EXECUTION_DETAIL_ASYNC_MUTEX
+#define INCLUDED_BEMAN_EXECUTION_DETAIL_ASYNC_MUTEX
+
+#include <beman/execution/detail/async_semaphore.hpp>
+
+// ----------------------------------------------------------------------------
+
+namespace beman::execution {
+/*!
+ * \brief Mutex whose `lock()` returns a sender
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ *
+ * \details
+ * The sender returned from `lock()` completes with `set_value()` once the
+ * mutex is owned. Instead of blocking a thread, contending operations are
+ * queued and `unlock()` hands the mutex to the oldest queued operation whose
+ * receiver is completed on the unlocking thread. A queued operation whose
+ * receiver's stop token gets triggered completes with `set_stopped()`
+ * without acquiring the mutex.
+ */
+class async_mutex {
+  public:
+    using sender = ::beman::execution::detail::async_semaphore::sender;
+
+    auto lock() noexcept -> sender { return this->sem.acquire(); }
+    auto try_lock() noexcept -> bool { return this->sem.try_acquire(); }
+    auto unlock() noexcept -> void { this->sem.release(1); }
+
+  private:
+    ::beman::execution::detail::async_semaphore sem{1};
+};
+} // namespace beman::execution
+
+// ----------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,280 @@
+// include/beman/execution/detail/async_semaphore.hpp               -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef INCLUDED_BEMAN_EXECUTION_DETAIL_ASYNC_SEMAPHORE
+#define INCLUDED_BEMAN_EXECUTION_DETAIL_ASYNC_SEMAPHORE
+
+#include <beman/execution/detail/completion_signatures.hpp>
+#include <beman/execution/detail/env_of_t.hpp>
+#include <beman/execution/detail/get_env.hpp>
+#include <beman/execution/detail/get_stop_token.hpp>
+#include <beman/execution/detail/immovable.hpp>
+#include <beman/execution/detail/operation_state.hpp>
+#include <beman/execution/detail/sender.hpp>
+#include <beman/execution/detail/set_stopped.hpp>
+#include <beman/execution/detail/set_value.hpp>
+#include <beman/execution/detail/stop_callback_for_t.hpp>
+#include <beman/execution/detail/stop_token_of_t.hpp>
+#include <beman/execution/detail/unstoppable_token.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+// ----------------------------------------------------------------------------
+
+namespace beman::execution::detail {
+/*!
+ * \brief Counting semaphore whose acquire operation is a sender
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ * \internal
+ *
+ * \details
+ * Acquiring takes a unit from an atomic counter without locking if there
+ * are no waiters. Otherwise, or if no unit is available, the operation state
+ * is appended to an intrusive FIFO list of waiters. Releasing units only takes
+ * the lock if there are waiters in which case the units are handed directly to
+ * the waiters in FIFO order, i.e., newer acquirers can't overtake older
+ * waiters. Waiters whose receiver has a stop token register a
+ * stop callback removing them from the list, completing with `set_stopped()`.
+ * The receiver completes on the thread releasing the unit which woke it up
+ * or inline from `start()` if a unit is immediately available. Units released
+ * while waiters are notified, e.g., by a waiter completing synchronously, are
+ * handed over by the already running `release()` loop rather than recursively.
+ */
+class async_semaphore : ::beman::execution::detail::immovable {
+  private:
+    struct waiter : ::beman::execution::detail::virtual_immovable {
+        waiter*      prev{};
+        waiter*      next{};
+        bool         queued{};
+        virtual auto granted() noexcept -> void = 0;
+    };
+
+    template <typename Receiver>
+    class opstate;
+
+    ::std::atomic<::std::ptrdiff_t> available;
+    ::std::atomic<::std::size_t>    waiting{};
+    ::std::atomic<::std::ptrdiff_t> releasing{};
+    ::std::mutex                    lock{};
+    waiter*                         head{};
+    waiter*                         tail{};
+
+    auto take_unit() noexcept -> bool {
+        ::std::ptrdiff_t count{this->available.load(::std::memory_order_seq_cst)};
+        while (0 < count) {
+            if (this->available.compare_exchange_weak(count, count - 1, ::std::memory_order_acquire))
+                return true;
+        }
+        return false;
+    }
+    //! Takes a unit without locking unless there are waiters which need to be served first.
+    auto try_take() noexcept -> bool {
+        return 0u == this->waiting.load(::std::memory_order_seq_cst) && this->take_unit();
+    }
+    auto unlink(waiter* w) noexcept -> void {
+        (w->prev ? w->prev->next : this->head) = w->next;
+        (w->next ? w->next->prev : this->tail) = w->prev;
+        w->queued = false;
+        this->waiting.fetch_sub(1u, ::std::memory_order_relaxed);
+    }
+    //! Unlinks waiters from the head, handing count units over directly, then using available units.
+    auto collect(::std::ptrdiff_t count) noexcept -> waiter* {
+        waiter*  ready{};
+        waiter** ready_tail{&ready};
+        while (this->head) {
+            if (0 < count)
+                --count;
+            else if (not this->take_unit())
+                break;
+            waiter* w{this->head};
+            this->unlink(w);
+            w->next     = nullptr;
+            *ready_tail = w;
+            ready_tail  = &w->next;
+        }
+        if (0 < count)
+            this->available.fetch_add(count, ::std::memory_order_seq_cst);
+        return ready;
+    }
+    //! Notifies the collected waiters except self (which completes inline) outside of the lock.
+    static auto grant(waiter* ready, waiter* self = nullptr) noexcept -> void {
+        while (ready) {
+            waiter* w{::std::exchange(ready, ready->next)};
+            if (w != self)
+                w->granted();
+        }
+    }
+    //! Either takes a unit (returning false) or appends w to the waiters (returning true).
+    auto enqueue(waiter* w) -> bool {
+        waiter* ready{};
+        bool    queued{};
+        {
+            ::std::lock_guard guard(this->lock);
+            this->waiting.fetch_add(1u, ::std::memory_order_seq_cst);
+            if (nullptr == this->head && this->take_unit()) {
+                this->waiting.fetch_sub(1u, ::std::memory_order_relaxed);
+                return false;
+            }
+            w->prev   = ::std::exchange(this->tail, w);
+            w->next   = nullptr;
+            w->queued = true;
+            (w->prev ? w->prev->next : this->head) = w;
+            // A unit released while the waiters were changing is passed on in FIFO order.
+            ready  = this->collect(0);
+            queued = w->queued;
+        }
+        async_semaphore::grant(ready, w);
+        return queued;
+    }
+    //! Removes w from the waiters, returning false if it was already granted a unit.
+    auto cancel(waiter* w) noexcept -> bool {
+        ::std::lock_guard guard(this->lock);
+        if (not w->queued)
+            return false;
+        this->unlink(w);
+        return true;
+    }
+
+  public:
+    class sender;
+
+    explicit async_semaphore(::std::ptrdiff_t initial) noexcept : available(initial) {}
+
+    auto try_acquire() noexcept -> bool { return this->try_take(); }
+    auto release(::std::ptrdiff_t count = 1) noexcept -> void {
+        if (0u == this->waiting.load(::std::memory_order_seq_cst)) {
+            this->available.fetch_add(count, ::std::memory_order_seq_cst);
+            if (0u == this->waiting.load(::std::memory_order_seq_cst))
+                return;
+            // A waiter arrived concurrently: reclaim the published units which weren't taken, yet.
+            ::std::ptrdiff_t published{::std::exchange(count, 0)};
+            while (count != published && this->take_unit())
+                ++count;
+            if (0 == count)
+                return;
+        }
+
+        // A waiter granted a unit may release one synchronously: the units are passed to the call
+        // already handing units to waiters to avoid recursing once per waiter.
+        if (0 != this->releasing.fetch_add(count, ::std::memory_order_acq_rel))
+            return;
+        do {
+            count = this->releasing.load(::std::memory_order_acquire);
+            waiter* ready{};
+            {
+                ::std::lock_guard guard(this->lock);
+                ready = this->collect(count);
+            }
+            async_semaphore::grant(ready);
+        } while (this->releasing.fetch_sub(count, ::std::memory_order_acq_rel) != count);
+    }
+    auto acquire() noexcept -> sender;
+};
+
+template <typename Receiver>
+class async_semaphore::opstate : async_semaphore::waiter {
+  private:
+    using token_t = ::beman::execution::stop_token_of_t<::beman::execution::env_of_t<Receiver>>;
+    static constexpr bool stoppable{not ::beman::execution::unstoppable_token<token_t>};
+
+    struct cb_t {
+        opstate* op;
+        auto     operator()() const noexcept -> void { this->op->cancelled(); }
+    };
+    struct stop_state {
+        ::std::optional<::beman::execution::stop_callback_for_t<token_t, cb_t>> callback{};
+        ::std::atomic<bool>                                                     handoff{};
+        bool                                                                    granted{};
+    };
+    struct no_stop_state {};
+
+    async_semaphore*                                                                  sem;
+    Receiver                                                                          receiver;
+    [[no_unique_address]] ::std::conditional_t<stoppable, stop_state, no_stop_state> stop{};
+
+    auto token() const noexcept -> token_t {
+        return ::beman::execution::get_stop_token(::beman::execution::get_env(this->receiver));
+    }
+    //! Called by whichever of start(), granted(), or cancelled() comes last.
+    auto complete() noexcept -> void {
+        if (this->stop.granted) {
+            this->stop.callback.reset();
+            ::beman::execution::set_value(::std::move(this->receiver));
+        } else {
+            ::beman::execution::set_stopped(::std::move(this->receiver));
+        }
+    }
+    auto granted() noexcept -> void override {
+        if constexpr (stoppable) {
+            this->stop.granted = true;
+            if (this->stop.handoff.exchange(true, ::std::memory_order_acq_rel))
+                this->complete();
+        } else {
+            ::beman::execution::set_value(::std::move(this->receiver));
+        }
+    }
+    auto cancelled() noexcept -> void {
+        if (this->sem->cancel(this) && this->stop.handoff.exchange(true, ::std::memory_order_acq_rel))
+            this->complete();
+    }
+
+  public:
+    using operation_state_concept = ::beman::execution::operation_state_t;
+
+    template <typename R>
+    opstate(async_semaphore* s, R&& rcvr) : sem(s), receiver(::std::forward<R>(rcvr)) {}
+
+    auto start() & noexcept -> void {
+        if (this->sem->try_take()) {
+            ::beman::execution::set_value(::std::move(this->receiver));
+            return;
+        }
+        if constexpr (stoppable) {
+            if (this->token().stop_requested()) {
+                ::beman::execution::set_stopped(::std::move(this->receiver));
+                return;
+            }
+        }
+        if (not this->sem->enqueue(this)) {
+            ::beman::execution::set_value(::std::move(this->receiver));
+            return;
+        }
+        if constexpr (stoppable) {
+            this->stop.callback.emplace(this->token(), cb_t{this});
+            if (this->stop.handoff.exchange(true, ::std::memory_order_acq_rel))
+                this->complete();
+        }
+    }
+};
+
+class async_semaphore::sender {
+  public:
+    using sender_concept = ::beman::execution::sender_t;
+    using completion_signatures =
+        ::beman::execution::completion_signatures<::beman::execution::set_value_t(),
+                                                  ::beman::execution::set_stopped_t()>;
+
+    explicit sender(async_semaphore* s) noexcept : sem(s) {}
+
+    template <typename Receiver>
+    auto connect(Receiver&& receiver) const noexcept(::std::is_nothrow_constructible_v<::std::decay_t<Receiver>,
+                                                                                        Receiver>)
+        -> opstate<::std::decay_t<Receiver>> {
+        return {this->sem, ::std::forward<Receiver>(receiver)};
+    }
+
+  private:
+    async_semaphore* sem;
+};
+
+inline auto async_semaphore::acquire() noexcept -> sender { return sender{this}; }
+} // namespace beman::execution::detail
+
+// ----------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,71 @@
+// include/beman/execution/detail/async_waiters.hpp                 -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef INCLUDED_BEMAN_EXECUTION_DETAIL_ASYNC_WAITERS
+#define INCLUDED_BEMAN_EXECUTION_DETAIL_ASYNC_WAITERS
+
+#include <beman/execution/detail/atomic_intrusive_stack.hpp>
+#include <beman/execution/detail/completion_signatures.hpp>
+#include <beman/execution/detail/immovable.hpp>
+#include <beman/execution/detail/intrusive_stack.hpp>
+#include <beman/execution/detail/operation_state.hpp>
+#include <beman/execution/detail/set_value.hpp>
+
+#include <utility>
+
+// ----------------------------------------------------------------------------
+
+namespace beman::execution::detail {
+/*!
+ * \brief Node of the lock-free waiter stack of the async synchronization primitives
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ * \internal
+ */
+struct async_waiter : ::beman::execution::detail::virtual_immovable {
+    async_waiter* next{};
+    virtual auto  notify() noexcept -> void = 0;
+};
+
+using async_waiter_stack = ::beman::execution::detail::atomic_intrusive_stack<&async_waiter::next>;
+
+/*!
+ * \brief Notifies the waiters popped from an async_waiter_stack in the order they were pushed
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ * \internal
+ */
+inline auto notify_waiters(::beman::execution::detail::intrusive_stack<&async_waiter::next> waiters) noexcept
+    -> void {
+    ::beman::execution::detail::intrusive_stack<&async_waiter::next> fifo{};
+    while (auto* w{waiters.pop()})
+        fifo.push(w);
+    while (auto* w{fifo.pop()})
+        w->notify();
+}
+
+/*!
+ * \brief Base of the operation states of the senders waiting on an async synchronization primitive
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ * \internal
+ *
+ * \details
+ * Being notified completes the receiver with `set_value()`. The waiters are
+ * linked through the operation states, i.e., waiting doesn't allocate.
+ */
+template <typename Receiver>
+struct async_waiter_state : ::beman::execution::detail::async_waiter {
+    using operation_state_concept = ::beman::execution::operation_state_t;
+
+    Receiver receiver;
+
+    template <typename R>
+    explicit async_waiter_state(R&& rcvr) : receiver(::std::forward<R>(rcvr)) {}
+
+    auto notify() noexcept -> void override { ::beman::execution::set_value(::std::move(this->receiver)); }
+};
+
+using async_waiter_signatures = ::beman::execution::completion_signatures<::beman::execution::set_value_t()>;
+} // namespace beman::execution::detail
+
+// ----------------------------------------------------------------------------
+
+#endif
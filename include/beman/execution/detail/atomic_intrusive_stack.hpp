@@ -26,8 +26,13 @@ class atomic_intrusive_stack;
 //! pop_all_and_shutdown() is a lock-free operation that pops all items from the stack and returns them in a
 //! queue. If the stack is empty, it returns an empty queue.
 //!
+//! pop_all() is a lock-free operation that pops all items from the stack without closing it.
+//!
+//! try_reopen() puts a closed stack back into the empty and open state.
+//!
 //! We use this stack in the split implementation to store the listeners that are waiting for the operation to
-//! complete.
+//! complete, in the strand implementation to collect the work submitted to the strand, and for the waiters of the
+//! notifier and the async event, latch, and barrier types.
 //!
 //! @tparam Item  The type of the item in the stack.
 //! @tparam Next  The pointer to the next item in the stack.
@@ -65,6 +70,32 @@ class atomic_intrusive_stack<Next> {
     //! @brief  Tests if the stack is empty and not in the closed state.
     auto empty_and_not_shutdown() const noexcept -> bool { return head_.load() == nullptr; }
 
+    //! @brief  Tests if the stack is in the closed state.
+    auto is_shutdown() const noexcept -> bool { return head_.load() == static_cast<const void*>(this); }
+
+    //! @brief  Puts a stack in the closed state back into the empty and open state.
+    //!
+    //! @return  Whether the stack was in the closed state.
+    auto try_reopen() noexcept -> bool {
+        void* ptr = this;
+        return head_.compare_exchange_strong(ptr, nullptr);
+    }
+
+    //! @brief  Pops all items from the stack and returns them, leaving the stack empty but open.
+    //!
+    //! @return  If the stack is empty or in the closed state, returns an empty stack.
+    auto pop_all() noexcept -> ::beman::execution::detail::intrusive_stack<Next> {
+        auto  stack = ::beman::execution::detail::intrusive_stack<Next>{};
+        void* ptr   = head_.load();
+        do {
+            if (ptr == this || ptr == nullptr) {
+                return stack;
+            }
+        } while (!head_.compare_exchange_weak(ptr, nullptr));
+        stack.head_ = static_cast<Item*>(ptr);
+        return stack;
+    }
+
     //! @brief  Pops all items from the stack, returns them and puts this stack into the closed state.
     //!
     //! @return  If the stack is empty, returns an empty stack.
@@ -13,6 +13,7 @@
 #include <beman/execution/detail/connect_all_result.hpp>
 #include <beman/execution/detail/valid_specialization.hpp>
 #include <beman/execution/detail/start.hpp>
+#include <beman/execution/detail/trace.hpp>
 #include <functional>
 #include <utility>
 
@@ -52,6 +53,8 @@ struct basic_operation : ::beman::execution::detail::basic_state<Sender, Receive
 
   private:
     auto start() & noexcept -> void {
+        ::beman::execution::detail::trace_start<tag_t>(
+            static_cast<::beman::execution::detail::basic_state<Sender, Receiver>*>(this), this->receiver);
         ::std::invoke(
             [this]<::std::size_t... I>(::std::index_sequence<I...>) {
                 ::beman::execution::detail::impls_for<tag_t>::start(
@@ -15,6 +15,7 @@
 #include <beman/execution/detail/valid_specialization.hpp>
 #include <beman/execution/detail/get_env.hpp>
 #include <beman/execution/detail/set_error.hpp>
+#include <beman/execution/detail/set_next.hpp>
 #include <beman/execution/detail/set_stopped.hpp>
 #include <beman/execution/detail/set_value.hpp>
 #include <utility>
@@ -33,6 +34,7 @@ template <typename Sender, typename Receiver, typename Index>
     struct basic_receiver {
     friend struct ::beman::execution::get_env_t;
     friend struct ::beman::execution::set_error_t;
+    friend struct ::beman::execution::set_next_t;
     friend struct ::beman::execution::set_stopped_t;
     friend struct ::beman::execution::set_value_t;
 
@@ -40,6 +42,7 @@ template <typename Sender, typename Receiver, typename Index>
     using tag_t                           = ::beman::execution::tag_of_t<Sender>;
     using state_t                         = ::beman::execution::detail::state_type<Sender, Receiver>;
     static constexpr const auto& complete = ::beman::execution::detail::impls_for<tag_t>::complete;
+    static constexpr const auto& next     = ::beman::execution::detail::impls_for<tag_t>::next;
     ::beman::execution::detail::basic_state<Sender, Receiver>* op{};
 
   private:
@@ -74,6 +77,16 @@ template <typename Sender, typename Receiver, typename Index>
         this->complete(Index(), this->op->state, this->op->receiver, ::beman::execution::set_stopped_t());
     }
 
+    template <typename Item>
+    auto set_next(Item&& item) & noexcept(noexcept(next(Index(),
+                                                        this->op->state,
+                                                        this->op->receiver,
+                                                        ::std::forward<Item>(item)))) -> decltype(auto)
+        requires ::beman::execution::detail::callable<decltype(next), Index, state_t&, Receiver&, Item>
+    {
+        return this->next(Index(), this->op->state, this->op->receiver, ::std::forward<Item>(item));
+    }
+
     auto get_env() const noexcept -> ::beman::execution::detail::env_type<Index, Sender, Receiver> {
         return ::beman::execution::detail::impls_for<tag_t>::get_env(Index(), this->op->state, this->op->receiver);
     }
@@ -13,6 +13,7 @@
 #include <beman/execution/detail/sender_decompose.hpp>
 #include <beman/execution/detail/connect.hpp>
 #include <beman/execution/detail/get_completion_signatures.hpp>
+#include <beman/execution/detail/trace.hpp>
 #include <utility>
 
 #include <beman/execution/detail/suppress_push.hpp>
@@ -20,6 +21,16 @@
 // ----------------------------------------------------------------------------
 
 namespace beman::execution::detail {
+/*!
+ * \brief Trait determining the `sender_concept` of a `basic_sender` using the tag `Tag`
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ * \internal
+ */
+template <typename Tag>
+struct basic_sender_concept {
+    using type = ::beman::execution::sender_t;
+};
+
 /*!
  * \brief Class template used to factor out common sender implementation for library senders.
  * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
@@ -29,7 +40,7 @@ template <typename Tag, typename Data, typename... Child>
 struct basic_sender : ::beman::execution::detail::product_type<Tag, Data, Child...> {
     friend struct ::beman::execution::connect_t;
     friend struct ::beman::execution::get_completion_signatures_t;
-    using sender_concept = ::beman::execution::sender_t;
+    using sender_concept = typename ::beman::execution::detail::basic_sender_concept<Tag>::type;
     using indices_for    = ::std::index_sequence_for<Child...>;
 
     auto get_env() const noexcept -> decltype(auto) {
@@ -43,34 +54,35 @@ struct basic_sender : ::beman::execution::detail::product_type<Tag, Data, Child.
     auto connect(Receiver receiver) = BEMAN_EXECUTION_DELETE("the passed receiver doesn't model receiver");
 
   private:
+    template <typename Self, typename Receiver>
+    using operation_t = ::beman::execution::detail::
+        basic_operation<Self, ::beman::execution::detail::traced_receiver_t<Tag, Receiver>>;
+
 #if __cpp_explicit_this_parameter < 302110L //-dk:TODO need to figure out how to use explicit this with forwarding
     template <::beman::execution::receiver Receiver>
-    auto connect(Receiver receiver) & noexcept(
-        noexcept(::beman::execution::detail::basic_operation<basic_sender&, Receiver>{*this, ::std::move(receiver)}))
-        -> ::beman::execution::detail::basic_operation<basic_sender&, Receiver> {
-        return {*this, ::std::move(receiver)};
+    auto connect(Receiver receiver) & noexcept(noexcept(operation_t<basic_sender&, Receiver>{
+        *this, ::beman::execution::detail::trace_receiver_for<Tag>(::std::move(receiver))}))
+        -> operation_t<basic_sender&, Receiver> {
+        return {*this, ::beman::execution::detail::trace_receiver_for<Tag>(::std::move(receiver))};
     }
     template <::beman::execution::receiver Receiver>
-    auto connect(Receiver receiver) const& noexcept(noexcept(
-        ::beman::execution::detail::basic_operation<const basic_sender&, Receiver>{*this, ::std::move(receiver)}))
-        -> ::beman::execution::detail::basic_operation<const basic_sender&, Receiver> {
-        return {*this, ::std::move(receiver)};
+    auto connect(Receiver receiver) const& noexcept(noexcept(operation_t<const basic_sender&, Receiver>{
+        *this, ::beman::execution::detail::trace_receiver_for<Tag>(::std::move(receiver))}))
+        -> operation_t<const basic_sender&, Receiver> {
+        return {*this, ::beman::execution::detail::trace_receiver_for<Tag>(::std::move(receiver))};
     }
     template <::beman::execution::receiver Receiver>
-    auto connect(Receiver receiver) && noexcept(
-        noexcept(::beman::execution::detail::basic_operation<basic_sender, Receiver>{::std::move(*this),
-                                                                                     ::std::move(receiver)}))
-        -> ::beman::execution::detail::basic_operation<basic_sender, Receiver> {
-        return {::std::move(*this), ::std::move(receiver)};
+    auto connect(Receiver receiver) && noexcept(noexcept(operation_t<basic_sender, Receiver>{
+        ::std::move(*this), ::beman::execution::detail::trace_receiver_for<Tag>(::std::move(receiver))}))
+        -> operation_t<basic_sender, Receiver> {
+        return {::std::move(*this), ::beman::execution::detail::trace_receiver_for<Tag>(::std::move(receiver))};
     }
 #else
     template <::beman::execution::detail::decays_to<basic_sender> Self, ::beman::execution::receiver Receiver>
-    auto
-    connect(this Self&& self,
-            Receiver receiver) noexcept(noexcept(::beman::execution::detail::basic_operation<basic_sender, Receiver>{
-        ::std::forward<Self>(self), ::std::move(receiver)}))
-        -> ::beman::execution::detail::basic_operation<Self, Receiver> {
-        return {::std::forward<Self>(self), ::std::move(receiver)};
+    auto connect(this Self&& self, Receiver receiver) noexcept(noexcept(operation_t<basic_sender, Receiver>{
+        ::std::forward<Self>(self), ::beman::execution::detail::trace_receiver_for<Tag>(::std::move(receiver))}))
+        -> operation_t<Self, Receiver> {
+        return {::std::forward<Self>(self), ::beman::execution::detail::trace_receiver_for<Tag>(::std::move(receiver))};
     }
 #endif
 #if __cpp_explicit_this_parameter < 302110L
@@ -0,0 +1,379 @@
+// include/beman/execution/detail/batch.hpp                         -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef INCLUDED_BEMAN_EXECUTION_DETAIL_BATCH
+#define INCLUDED_BEMAN_EXECUTION_DETAIL_BATCH
+
+#include <beman/execution/detail/completion_signatures.hpp>
+#include <beman/execution/detail/env_of_t.hpp>
+#include <beman/execution/detail/get_env.hpp>
+#include <beman/execution/detail/get_stop_token.hpp>
+#include <beman/execution/detail/immovable.hpp>
+#include <beman/execution/detail/operation_state.hpp>
+#include <beman/execution/detail/receiver.hpp>
+#include <beman/execution/detail/sender.hpp>
+#include <beman/execution/detail/set_error.hpp>
+#include <beman/execution/detail/set_stopped.hpp>
+#include <beman/execution/detail/set_value.hpp>
+#include <beman/execution/detail/stop_callback_for_t.hpp>
+#include <beman/execution/detail/stop_token_of_t.hpp>
+#include <beman/execution/detail/timeout.hpp>
+#include <beman/execution/detail/timer_context.hpp>
+#include <beman/execution/detail/unstoppable_token.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// ----------------------------------------------------------------------------
+
+namespace beman::execution {
+template <typename T, typename BatchFn>
+    requires ::std::ranges::sized_range<::std::invoke_result_t<BatchFn&, ::std::span<T>>>
+class batch;
+}
+
+// ----------------------------------------------------------------------------
+
+/*!
+ * \brief Micro-batcher coalescing concurrently submitted inputs into one call of a batch function
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ *
+ * \details
+ * `submit(value)` yields a sender whose operation state links itself into the
+ * pending batch when started, i.e., queuing an input doesn't allocate. The
+ * pending batch is flushed when it holds `max_size` inputs or when
+ * `max_delay` elapsed since its first input got queued. Flushing moves the
+ * inputs into a contiguous buffer, invokes `batch_fn` once with a
+ * `std::span<T>` of the inputs, and completes each submitter's receiver with
+ * the result at the position of its input. The batch function returns a
+ * sized range with one result per input; if it throws or returns a range of
+ * the wrong size all receivers of the batch complete with `set_error()`. A
+ * full batch is flushed on the thread submitting the last input, a batch
+ * reaching its deadline on the thread of the `timer_context`, by default the
+ * one shared by the process. The batch function is invoked for one batch at
+ * a time: a batch flushed while another one is being processed is handed to
+ * the thread processing that batch which runs it afterwards, i.e., `batch_fn`
+ * doesn't need to be thread-safe and a receiver submitting to the `batch`
+ * doesn't recurse into the batch function. The deadline is a single timer entry owned by
+ * the `batch` which is added when the first input of a batch is queued and
+ * re-added by its expiry if a newer batch is pending. Queued operations whose
+ * receiver's stop token gets triggered leave the batch and complete with
+ * `set_stopped()`. Destroying the `batch` flushes the pending inputs and
+ * waits until no batch is processed anymore.
+ */
+template <typename T, typename BatchFn>
+    requires ::std::ranges::sized_range<::std::invoke_result_t<BatchFn&, ::std::span<T>>>
+class beman::execution::batch : ::beman::execution::detail::immovable {
+  public:
+    using result_type = ::std::remove_cvref_t<
+        ::std::ranges::range_reference_t<::std::invoke_result_t<BatchFn&, ::std::span<T>>>>;
+    using clock       = ::std::chrono::steady_clock;
+
+  private:
+    struct item : ::beman::execution::detail::virtual_immovable {
+        item*        prev{};
+        item*        next{};
+        item*        next_batch{};
+        bool         queued{};
+        T*           value{};
+        virtual auto complete(result_type&&) noexcept -> void      = 0;
+        virtual auto fail(::std::exception_ptr) noexcept -> void = 0;
+    };
+
+    struct deadline_entry : ::beman::execution::timer_context::entry {
+        batch* owner;
+        explicit deadline_entry(batch* b) noexcept : owner(b) {}
+        auto expire() noexcept -> void override { this->owner->expired(); }
+    };
+
+    template <typename Receiver>
+    class opstate;
+    struct sender;
+
+    ::std::size_t                      max_size_;
+    clock::duration                    max_delay_;
+    BatchFn                            fn;
+    ::beman::execution::timer_context* timer;
+    ::std::mutex                       lock{};
+    item*                              head{};
+    item*                              tail{};
+    ::std::size_t                      count{};
+    item*                              ready{};
+    item*                              ready_tail{};
+    bool                               flushing{};
+    ::std::condition_variable          idle{};
+    clock::time_point                  deadline{};
+    bool                               armed{};
+    deadline_entry                     entry{this};
+
+    //! Appends w to the pending batch, returning the batch if it became full.
+    auto enqueue(item* w) -> item* {
+        ::std::lock_guard guard(this->lock);
+        w->prev   = ::std::exchange(this->tail, w);
+        w->next   = nullptr;
+        w->queued = true;
+        (w->prev ? w->prev->next : this->head) = w;
+        if (++this->count == this->max_size_)
+            return this->detach();
+        if (this->count == 1u) {
+            this->deadline = clock::now() + this->max_delay_;
+            this->arm();
+        }
+        return nullptr;
+    }
+    //! Removes w from the pending batch, returning false if it was already flushed.
+    auto cancel(item* w) noexcept -> bool {
+        ::std::lock_guard guard(this->lock);
+        if (not w->queued)
+            return false;
+        (w->prev ? w->prev->next : this->head) = w->next;
+        (w->next ? w->next->prev : this->tail) = w->prev;
+        w->queued                              = false;
+        --this->count;
+        return true;
+    }
+    //! Takes the pending batch; needs to be called with the lock held.
+    auto detach() noexcept -> item* {
+        for (item* w{this->head}; w; w = w->next)
+            w->queued = false;
+        this->tail  = nullptr;
+        this->count = 0u;
+        return ::std::exchange(this->head, nullptr);
+    }
+    /*!
+     * Queues the detached batch list to be run. The first thread finding no
+     * other flusher runs the queued batches one at a time until none is left;
+     * the batches are only accessed by the flusher once they got queued.
+     */
+    auto flush(item* list) noexcept -> void {
+        if (list == nullptr)
+            return;
+        {
+            ::std::lock_guard guard(this->lock);
+            list->next_batch                                               = nullptr;
+            (this->ready_tail ? this->ready_tail->next_batch : this->ready) = list;
+            this->ready_tail                                               = list;
+            if (::std::exchange(this->flushing, true))
+                return;
+        }
+        while (true) {
+            {
+                ::std::lock_guard guard(this->lock);
+                list = this->ready;
+                if (list == nullptr) {
+                    this->flushing = false;
+                    this->idle.notify_all();
+                    return;
+                }
+                this->ready = list->next_batch;
+                if (this->ready == nullptr)
+                    this->ready_tail = nullptr;
+            }
+            this->run(list);
+        }
+    }
+    //! Invokes the batch function for the inputs of list and completes its operations.
+    auto run(item* list) noexcept -> void {
+        try {
+            ::std::vector<T> inputs;
+            for (item* w{list}; w; w = w->next)
+                inputs.push_back(::std::move(*w->value));
+            auto&& results{::std::invoke(this->fn, ::std::span<T>(inputs))};
+            if (::std::ranges::size(results) != inputs.size())
+                throw ::std::length_error("batch function returned the wrong number of results");
+            auto it{::std::ranges::begin(results)};
+            while (list) {
+                result_type result(::std::move(*it));
+                ++it;
+                ::std::exchange(list, list->next)->complete(::std::move(result));
+            }
+        } catch (...) {
+            ::std::exception_ptr error{::std::current_exception()};
+            while (list)
+                ::std::exchange(list, list->next)->fail(error);
+        }
+    }
+    //! Adds the deadline entry unless it is still pending; needs to be called with the lock held.
+    auto arm() -> void {
+        if (not this->armed) {
+            this->timer->add(this->entry, this->deadline);
+            this->armed = true;
+        }
+    }
+    //! Flushes the pending batch if its deadline passed; otherwise the entry belonged to an older batch.
+    auto expired() noexcept -> void {
+        item* list{};
+        {
+            ::std::lock_guard guard(this->lock);
+            this->armed = false;
+            if (this->head == nullptr)
+                return;
+            if (clock::now() < this->deadline) {
+                this->arm();
+                return;
+            }
+            list = this->detach();
+        }
+        this->flush(list);
+    }
+
+  public:
+    batch(::std::size_t                      max_size,
+          clock::duration                    max_delay,
+          BatchFn                            batch_fn,
+          ::beman::execution::timer_context& timer = ::beman::execution::detail::default_timer_context())
+        : max_size_(max_size < 1u ? 1u : max_size), max_delay_(max_delay), fn(::std::move(batch_fn)), timer(&timer) {}
+    ~batch() {
+        this->timer->cancel(this->entry);
+        item* list{};
+        {
+            ::std::lock_guard guard(this->lock);
+            list = this->detach();
+        }
+        this->flush(list);
+        ::std::unique_lock guard(this->lock);
+        this->idle.wait(guard, [this] { return not this->flushing; });
+    }
+
+    auto max_size() const noexcept -> ::std::size_t { return this->max_size_; }
+    auto max_delay() const noexcept -> clock::duration { return this->max_delay_; }
+    auto submit(T value) noexcept(::std::is_nothrow_move_constructible_v<T>) -> sender {
+        return {this, ::std::move(value)};
+    }
+};
+
+template <typename T, typename BatchFn>
+    requires ::std::ranges::sized_range<::std::invoke_result_t<BatchFn&, ::std::span<T>>>
+template <typename Receiver>
+class beman::execution::batch<T, BatchFn>::opstate : batch<T, BatchFn>::item {
+  private:
+    using token_t = ::beman::execution::stop_token_of_t<::beman::execution::env_of_t<Receiver>>;
+    static constexpr bool stoppable{not ::beman::execution::unstoppable_token<token_t>};
+
+    struct cb_t {
+        opstate* op;
+        auto     operator()() const noexcept -> void { this->op->cancelled(); }
+    };
+    struct stop_state {
+        ::std::optional<::beman::execution::stop_callback_for_t<token_t, cb_t>> callback{};
+        ::std::atomic<bool>                                                     handoff{};
+        ::std::optional<result_type>                                            result{};
+        ::std::exception_ptr                                                    error{};
+    };
+    struct no_stop_state {};
+
+    batch*                                                                            owner;
+    T                                                                                 input;
+    Receiver                                                                          receiver;
+    [[no_unique_address]] ::std::conditional_t<stoppable, stop_state, no_stop_state> stop{};
+
+    auto token() const noexcept -> token_t {
+        return ::beman::execution::get_stop_token(::beman::execution::get_env(this->receiver));
+    }
+    //! Called by whichever of start(), the flush, or cancelled() comes last.
+    auto finish() noexcept -> void {
+        this->stop.callback.reset();
+        if (this->stop.result)
+            ::beman::execution::set_value(::std::move(this->receiver), ::std::move(*this->stop.result));
+        else if (this->stop.error)
+            ::beman::execution::set_error(::std::move(this->receiver), ::std::move(this->stop.error));
+        else
+            ::beman::execution::set_stopped(::std::move(this->receiver));
+    }
+    auto complete(result_type&& result) noexcept -> void override {
+        if constexpr (stoppable) {
+            this->stop.result.emplace(::std::move(result));
+            if (this->stop.handoff.exchange(true, ::std::memory_order_acq_rel))
+                this->finish();
+        } else {
+            ::beman::execution::set_value(::std::move(this->receiver), ::std::move(result));
+        }
+    }
+    auto fail(::std::exception_ptr error) noexcept -> void override {
+        if constexpr (stoppable) {
+            this->stop.error = ::std::move(error);
+            if (this->stop.handoff.exchange(true, ::std::memory_order_acq_rel))
+                this->finish();
+        } else {
+            ::beman::execution::set_error(::std::move(this->receiver), ::std::move(error));
+        }
+    }
+    auto cancelled() noexcept -> void {
+        if (this->owner->cancel(this) && this->stop.handoff.exchange(true, ::std::memory_order_acq_rel))
+            this->finish();
+    }
+
+  public:
+    using operation_state_concept = ::beman::execution::operation_state_t;
+
+    template <typename R>
+    opstate(batch* b, T&& in, R&& rcvr)
+        : owner(b), input(::std::move(in)), receiver(::std::forward<R>(rcvr)) {
+        this->value = &this->input;
+    }
+
+    auto start() & noexcept -> void {
+        if constexpr (stoppable) {
+            if (this->token().stop_requested()) {
+                ::beman::execution::set_stopped(::std::move(this->receiver));
+                return;
+            }
+        }
+        // once queued (or, if stoppable, after the handoff) the operation may complete
+        // and get destroyed: the batch is only accessed through a local afterwards
+        batch* b{this->owner};
+        item*  full{};
+        try {
+            full = b->enqueue(this);
+        } catch (...) {
+            ::beman::execution::set_error(::std::move(this->receiver), ::std::current_exception());
+            return;
+        }
+        if constexpr (stoppable) {
+            this->stop.callback.emplace(this->token(), cb_t{this});
+            if (this->stop.handoff.exchange(true, ::std::memory_order_acq_rel))
+                this->finish();
+        }
+        b->flush(full);
+    }
+};
+
+template <typename T, typename BatchFn>
+    requires ::std::ranges::sized_range<::std::invoke_result_t<BatchFn&, ::std::span<T>>>
+struct beman::execution::batch<T, BatchFn>::sender {
+    using sender_concept = ::beman::execution::sender_t;
+    using completion_signatures =
+        ::beman::execution::completion_signatures<::beman::execution::set_value_t(result_type),
+                                                  ::beman::execution::set_error_t(::std::exception_ptr),
+                                                  ::beman::execution::set_stopped_t()>;
+
+    batch* owner;
+    T      value;
+
+    template <::beman::execution::receiver Receiver>
+    auto connect(Receiver&& receiver) && -> opstate<::std::remove_cvref_t<Receiver>> {
+        return {this->owner, ::std::move(this->value), ::std::forward<Receiver>(receiver)};
+    }
+    template <::beman::execution::receiver Receiver>
+        requires ::std::copy_constructible<T>
+    auto connect(Receiver&& receiver) const& -> opstate<::std::remove_cvref_t<Receiver>> {
+        return {this->owner, T(this->value), ::std::forward<Receiver>(receiver)};
+    }
+};
+
+// ----------------------------------------------------------------------------
+
+#endif
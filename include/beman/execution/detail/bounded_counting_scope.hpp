@@ -0,0 +1,201 @@
+// include/beman/execution/detail/bounded_counting_scope.hpp        -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef INCLUDED_BEMAN_EXECUTION_DETAIL_BOUNDED_COUNTING_SCOPE
+#define INCLUDED_BEMAN_EXECUTION_DETAIL_BOUNDED_COUNTING_SCOPE
+
+#include <beman/execution/detail/async_semaphore.hpp>
+#include <beman/execution/detail/completion_signatures.hpp>
+#include <beman/execution/detail/completion_signatures_of_t.hpp>
+#include <beman/execution/detail/connect.hpp>
+#include <beman/execution/detail/connect_result_t.hpp>
+#include <beman/execution/detail/counting_scope_base.hpp>
+#include <beman/execution/detail/counting_scope_join.hpp>
+#include <beman/execution/detail/env_of_t.hpp>
+#include <beman/execution/detail/get_env.hpp>
+#include <beman/execution/detail/immovable.hpp>
+#include <beman/execution/detail/meta_combine.hpp>
+#include <beman/execution/detail/meta_unique.hpp>
+#include <beman/execution/detail/operation_state.hpp>
+#include <beman/execution/detail/receiver.hpp>
+#include <beman/execution/detail/scope_token.hpp>
+#include <beman/execution/detail/sender.hpp>
+#include <beman/execution/detail/set_error.hpp>
+#include <beman/execution/detail/set_stopped.hpp>
+#include <beman/execution/detail/set_value.hpp>
+#include <beman/execution/detail/start.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+// ----------------------------------------------------------------------------
+
+namespace beman::execution {
+class bounded_counting_scope;
+}
+
+namespace beman::execution::detail {
+/*!
+ * \brief Operation state running a sender once a slot of a bounded_counting_scope is free
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ * \internal
+ *
+ * \details
+ * The child is connected eagerly but only started once the acquisition of a
+ * slot completed. The slot is released before the child's completion is
+ * forwarded as the receiver may destroy the scope in response.
+ */
+template <::beman::execution::sender Sender, ::beman::execution::receiver Receiver>
+struct bounded_scope_state : ::beman::execution::detail::immovable {
+    using operation_state_concept = ::beman::execution::operation_state_t;
+
+    struct acquire_receiver {
+        using receiver_concept = ::beman::execution::receiver_t;
+        bounded_scope_state* st;
+
+        auto set_value() && noexcept -> void { ::beman::execution::start(this->st->child); }
+        auto set_stopped() && noexcept -> void { ::beman::execution::set_stopped(::std::move(this->st->receiver)); }
+        auto get_env() const noexcept -> ::beman::execution::env_of_t<Receiver> {
+            return ::beman::execution::get_env(this->st->receiver);
+        }
+    };
+    struct child_receiver {
+        using receiver_concept = ::beman::execution::receiver_t;
+        bounded_scope_state* st;
+
+        template <typename... Args>
+        auto set_value(Args&&... args) && noexcept -> void {
+            this->st->slots->release();
+            ::beman::execution::set_value(::std::move(this->st->receiver), ::std::forward<Args>(args)...);
+        }
+        template <typename Error>
+        auto set_error(Error&& error) && noexcept -> void {
+            this->st->slots->release();
+            ::beman::execution::set_error(::std::move(this->st->receiver), ::std::forward<Error>(error));
+        }
+        auto set_stopped() && noexcept -> void {
+            this->st->slots->release();
+            ::beman::execution::set_stopped(::std::move(this->st->receiver));
+        }
+        auto get_env() const noexcept -> ::beman::execution::env_of_t<Receiver> {
+            return ::beman::execution::get_env(this->st->receiver);
+        }
+    };
+    using acquire_t = ::beman::execution::connect_result_t<::beman::execution::detail::async_semaphore::sender,
+                                                           acquire_receiver>;
+    using child_t   = ::beman::execution::connect_result_t<Sender, child_receiver>;
+
+    ::beman::execution::detail::async_semaphore* slots;
+    Receiver                                     receiver;
+    acquire_t                                    acquire;
+    child_t                                      child;
+
+    template <typename S, typename R>
+    bounded_scope_state(::beman::execution::detail::async_semaphore* sem, S&& sndr, R&& rcvr)
+        : slots(sem),
+          receiver(::std::forward<R>(rcvr)),
+          acquire(::beman::execution::connect(this->slots->acquire(), acquire_receiver{this})),
+          child(::beman::execution::connect(::std::forward<S>(sndr), child_receiver{this})) {}
+
+    auto start() & noexcept -> void { ::beman::execution::start(this->acquire); }
+};
+
+/*!
+ * \brief Sender returned by `bounded_counting_scope::token::wrap()`
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ * \internal
+ */
+template <::beman::execution::sender Sender>
+struct bounded_scope_sender {
+    using sender_concept = ::beman::execution::sender_t;
+
+    ::beman::execution::detail::async_semaphore* slots;
+    Sender                                       sender;
+
+    template <typename Env>
+    auto get_completion_signatures(const Env&) const noexcept {
+        return ::beman::execution::detail::meta::unique<::beman::execution::detail::meta::combine<
+            ::beman::execution::completion_signatures_of_t<Sender, Env>,
+            ::beman::execution::completion_signatures<::beman::execution::set_stopped_t()>>>();
+    }
+    template <::beman::execution::receiver Receiver>
+    auto connect(Receiver&& receiver) && -> ::beman::execution::detail::
+        bounded_scope_state<Sender, ::std::remove_cvref_t<Receiver>> {
+        return {this->slots, ::std::move(this->sender), ::std::forward<Receiver>(receiver)};
+    }
+    template <::beman::execution::receiver Receiver>
+    auto connect(Receiver&& receiver) const& -> ::beman::execution::detail::
+        bounded_scope_state<const Sender&, ::std::remove_cvref_t<Receiver>> {
+        return {this->slots, this->sender, ::std::forward<Receiver>(receiver)};
+    }
+};
+} // namespace beman::execution::detail
+
+// ----------------------------------------------------------------------------
+
+/*!
+ * \brief Counting scope limiting the number of concurrently running associated senders
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ *
+ * \details
+ * The scope counts associations and supports `join()` and `close()` like
+ * `simple_counting_scope`. In addition, senders wrapped by the scope's
+ * token, i.e., senders passed to `spawn`, `spawn_future`, or `associate`,
+ * first acquire one of `max_concurrency()` slots before they start and
+ * release it when they complete. If no slot is free the operation waits,
+ * queued without allocation in its operation state, until another operation
+ * of the scope completes. Taking a free slot is a lock-free
+ * compare-and-swap. A waiting operation completes with `set_stopped()` if
+ * stop is requested via its receiver's stop token. Thus, bursts of work are
+ * applied to the downstream resources at the configured rate rather than all
+ * at once.
+ */
+class beman::execution::bounded_counting_scope : public ::beman::execution::detail::counting_scope_base {
+  public:
+    class token;
+
+    explicit bounded_counting_scope(::std::size_t max_concurrency) noexcept
+        : slots(::std::ptrdiff_t(max_concurrency)), limit(max_concurrency) {}
+
+    auto join() noexcept -> ::beman::execution::sender auto {
+        return ::beman::execution::detail::counting_scope_join(this);
+    }
+    auto get_token() noexcept -> token;
+    //! The maximum number of senders of this scope running concurrently.
+    auto max_concurrency() const noexcept -> ::std::size_t { return this->limit; }
+
+  private:
+    ::beman::execution::detail::async_semaphore slots;
+    ::std::size_t                               limit;
+};
+
+// ----------------------------------------------------------------------------
+
+class beman::execution::bounded_counting_scope::token
+    : public ::beman::execution::detail::counting_scope_base::token {
+  public:
+    template <::beman::execution::sender Sender>
+    auto wrap(Sender&& sender) const
+        -> ::beman::execution::detail::bounded_scope_sender<::std::remove_cvref_t<Sender>> {
+        return {&static_cast<::beman::execution::bounded_counting_scope*>(this->scope)->slots,
+                ::std::forward<Sender>(sender)};
+    }
+
+  private:
+    friend class beman::execution::bounded_counting_scope;
+    explicit token(::beman::execution::bounded_counting_scope* s)
+        : ::beman::execution::detail::counting_scope_base::token(s) {}
+};
+static_assert(::beman::execution::scope_token<::beman::execution::bounded_counting_scope::token>);
+
+// ----------------------------------------------------------------------------
+
+inline auto beman::execution::bounded_counting_scope::get_token() noexcept
+    -> beman::execution::bounded_counting_scope::token {
+    return beman::execution::bounded_counting_scope::token(this);
+}
+
+// ----------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,41 @@
+// include/beman/execution/detail/counting_semaphore.hpp            -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef INCLUDED_BEMAN_EXECUTION_DETAIL_COUNTING_SEMAPHORE
+#define INCLUDED_BEMAN_EXECUTION_DETAIL_COUNTING_SEMAPHORE
+
+#include <beman/execution/detail/async_semaphore.hpp>
+#include <cstddef>
+
+// ----------------------------------------------------------------------------
+
+namespace beman::execution {
+/*!
+ * \brief Counting semaphore whose `acquire()` returns a sender
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ *
+ * \details
+ * The sender returned from `acquire()` completes with `set_value()` once a
+ * unit was taken from the semaphore. If no unit is available the operation
+ * is queued without allocating and gets resumed in FIFO order by `release()`.
+ * A queued operation whose receiver's stop token gets triggered is removed
+ * from the queue and completes with `set_stopped()`.
+ */
+class counting_semaphore {
+  public:
+    using sender = ::beman::execution::detail::async_semaphore::sender;
+
+    explicit counting_semaphore(::std::ptrdiff_t initial = 0) noexcept : sem(initial) {}
+
+    auto acquire() noexcept -> sender { return this->sem.acquire(); }
+    auto try_acquire() noexcept -> bool { return this->sem.try_acquire(); }
+    auto release(::std::ptrdiff_t count = 1) noexcept -> void { this->sem.release(count); }
+
+  private:
+    ::beman::execution::detail::async_semaphore sem;
+};
+} // namespace beman::execution
+
+// ----------------------------------------------------------------------------
+
+#endif
@@ -13,6 +13,7 @@
 #include <beman/execution/detail/get_env.hpp>
 #include <beman/execution/detail/product_type.hpp>
 #include <beman/execution/detail/sender_decompose.hpp>
+#include <beman/execution/detail/set_next.hpp>
 #include <beman/execution/detail/start.hpp>
 
 #include <utility>
@@ -60,6 +61,13 @@ struct default_impls {
         static_assert(Index::value == 0);
         Tag()(::std::move(receiver), ::std::forward<Args>(args)...);
     };
+    static constexpr auto next =
+        []<typename Receiver, typename Item>(auto, auto&, Receiver& receiver, Item&& item) noexcept(
+            noexcept(::beman::execution::set_next(receiver, ::std::forward<Item>(item)))) -> decltype(auto)
+        requires ::beman::execution::detail::callable<::beman::execution::set_next_t, Receiver&, Item>
+    {
+        return ::beman::execution::set_next(receiver, ::std::forward<Item>(item));
+    };
 };
 } // namespace beman::execution::detail
 
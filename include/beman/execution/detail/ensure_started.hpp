@@ -0,0 +1,173 @@
+// include/beman/execution/detail/ensure_started.hpp                -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef INCLUDED_BEMAN_EXECUTION_DETAIL_ENSURE_STARTED
+#define INCLUDED_BEMAN_EXECUTION_DETAIL_ENSURE_STARTED
+
+#include <beman/execution/detail/basic_sender.hpp>
+#include <beman/execution/detail/completion_signatures_for.hpp>
+#include <beman/execution/detail/connect_result_t.hpp>
+#include <beman/execution/detail/default_impls.hpp>
+#include <beman/execution/detail/empty_env.hpp>
+#include <beman/execution/detail/impls_for.hpp>
+#include <beman/execution/detail/inplace_stop_source.hpp>
+#include <beman/execution/detail/make_sender.hpp>
+#include <beman/execution/detail/queryable.hpp>
+#include <beman/execution/detail/receiver.hpp>
+#include <beman/execution/detail/sender.hpp>
+#include <beman/execution/detail/sender_adaptor_closure.hpp>
+#include <beman/execution/detail/spawn_future.hpp>
+#include <beman/execution/detail/spawn_get_allocator.hpp>
+#include <beman/execution/detail/start.hpp>
+#include <beman/execution/detail/stop_when.hpp>
+#include <beman/execution/detail/write_env.hpp>
+#include <atomic>
+#include <memory>
+#include <utility>
+
+// ----------------------------------------------------------------------------
+
+namespace beman::execution::detail {
+/*!
+ * \brief Shared state of `ensure_started(sndr)` holding the started operation and its result
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ * \internal
+ *
+ * \details
+ * The state, the operation state of the started sender, and the result are
+ * one allocation obtained from the sender's allocator. The producer and
+ * the consumer hand off the result using one atomic pointer which is
+ * exchanged by whoever arrives: the completion stores `completed()`, the
+ * consumer stores its receiver, and abandoning the sender stores
+ * `abandoned()`. Whoever finds the other side already there does the
+ * remaining work.
+ */
+template <typename Allocator, ::beman::execution::sender Sndr, typename Env>
+struct ensure_started_state
+    : ::beman::execution::detail::spawn_future_state_base<::beman::execution::detail::spawn_future_sigs<Sndr, Env>> {
+    using alloc_t          = typename ::std::allocator_traits<Allocator>::template rebind_alloc<ensure_started_state>;
+    using traits_t         = ::std::allocator_traits<alloc_t>;
+    using spawned_sender_t = ::beman::execution::detail::future_spawned_sender<Sndr, Env>;
+    using sigs_t           = ::beman::execution::detail::spawn_future_sigs<Sndr, Env>;
+    using receiver_t       = ::beman::execution::detail::spawn_future_receiver<sigs_t>;
+    using op_t             = ::beman::execution::connect_result_t<spawned_sender_t, receiver_t>;
+
+    auto completed() noexcept -> void* { return &this->source; }
+    auto abandoned() noexcept -> void* { return &this->handoff; }
+
+    template <::beman::execution::sender S>
+    ensure_started_state(auto a, S&& s, Env env)
+        : alloc(::std::move(a)),
+          op(::beman::execution::write_env(
+                 ::beman::execution::detail::stop_when(::std::forward<S>(s), this->source.get_token()), env),
+             receiver_t{this}) {
+        ::beman::execution::start(this->op);
+    }
+
+    auto complete() noexcept -> void override {
+        void* consumer{this->handoff.exchange(this->completed(), ::std::memory_order_acq_rel)};
+        if (consumer == this->abandoned())
+            this->destroy();
+        else if (consumer != nullptr)
+            this->fun(consumer, *this);
+    }
+    auto abandon() noexcept -> void {
+        if (this->handoff.exchange(this->abandoned(), ::std::memory_order_acq_rel) == nullptr)
+            this->source.request_stop();
+        else
+            this->destroy();
+    }
+    template <::beman::execution::receiver Rcvr>
+    auto consume(Rcvr& rcvr) noexcept -> void {
+        this->fun = [](void* ptr, ensure_started_state& state) noexcept {
+            ensure_started_state::complete_receiver(*static_cast<Rcvr*>(ptr), state.result);
+        };
+        if (this->handoff.exchange(&rcvr, ::std::memory_order_acq_rel) == this->completed())
+            ensure_started_state::complete_receiver(rcvr, this->result);
+    }
+    template <::beman::execution::receiver Rcvr>
+    static auto complete_receiver(Rcvr& rcvr, typename ensure_started_state::result_t& res) noexcept -> void {
+        ::std::visit(
+            [&rcvr]<typename Tuplish>(Tuplish&& tuplish) noexcept {
+                if constexpr (!::std::same_as<::std::remove_cvref_t<Tuplish>, ::std::monostate>) {
+                    ::std::apply(
+                        [&rcvr]<typename... Args>(auto cpo, Args&&... args) {
+                            cpo(::std::move(rcvr), ::std::forward<Args>(args)...);
+                        },
+                        ::std::forward<Tuplish>(tuplish));
+                }
+            },
+            ::std::move(res));
+    }
+    auto destroy() noexcept -> void {
+        alloc_t a{this->alloc};
+        traits_t::destroy(a, this);
+        traits_t::deallocate(a, this, 1u);
+    }
+
+    alloc_t                                 alloc;
+    ::beman::execution::inplace_stop_source source{};
+    ::std::atomic<void*>                    handoff{};
+    auto (*fun)(void*, ensure_started_state&) noexcept -> void = nullptr;
+    op_t                                    op;
+};
+
+struct ensure_started_t : ::beman::execution::sender_adaptor_closure<ensure_started_t> {
+    template <::beman::execution::sender Sndr, typename Ev>
+        requires ::beman::execution::detail::queryable<::std::remove_cvref_t<Ev>>
+    auto operator()(Sndr&& sndr, Ev&& ev) const {
+        auto [alloc, senv] = ::beman::execution::detail::spawn_get_allocator(sndr, ev);
+        using state_t = ::beman::execution::detail::ensure_started_state<decltype(alloc), Sndr, decltype(senv)>;
+        using state_alloc_t  = typename ::std::allocator_traits<decltype(alloc)>::template rebind_alloc<state_t>;
+        using state_traits_t = ::std::allocator_traits<state_alloc_t>;
+        state_alloc_t state_alloc(alloc);
+        state_t*      state{state_traits_t::allocate(state_alloc, 1u)};
+        try {
+            state_traits_t::construct(state_alloc, state, alloc, ::std::forward<Sndr>(sndr), senv);
+        } catch (...) {
+            state_traits_t::deallocate(state_alloc, state, 1u);
+            throw;
+        }
+
+        using deleter = decltype([](state_t* p) noexcept { p->abandon(); });
+        return ::beman::execution::detail::make_sender(*this, ::std::unique_ptr<state_t, deleter>{state});
+    }
+    template <::beman::execution::sender Sndr>
+    auto operator()(Sndr&& sndr) const {
+        return (*this)(::std::forward<Sndr>(sndr), ::beman::execution::empty_env{});
+    }
+};
+
+template <typename State, typename Deleter, typename Env>
+struct completion_signatures_for_impl<
+    ::beman::execution::detail::basic_sender<::beman::execution::detail::ensure_started_t,
+                                             ::std::unique_ptr<State, Deleter>>,
+    Env> {
+    using type = typename State::sigs_t;
+};
+
+template <>
+struct impls_for<::beman::execution::detail::ensure_started_t> : ::beman::execution::detail::default_impls {
+    static constexpr auto start{[](auto& state, auto& rcvr) noexcept -> void { state->consume(rcvr); }};
+};
+} // namespace beman::execution::detail
+
+namespace beman::execution {
+using ensure_started_t = ::beman::execution::detail::ensure_started_t;
+/*!
+ * \brief `ensure_started(sndr)` starts `sndr` immediately and yields a sender for its result
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ *
+ * \details
+ * The result is stored until the returned sender is connected and started.
+ * If the returned sender is destroyed without being started, stop is
+ * requested for the started work and its result is discarded once it
+ * completes. Any allocation uses the allocator of the environment passed
+ * as optional second argument or of `sndr`'s environment.
+ */
+inline constexpr ensure_started_t ensure_started{};
+} // namespace beman::execution
+
+// ----------------------------------------------------------------------------
+
+#endif
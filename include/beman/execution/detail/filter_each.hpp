@@ -0,0 +1,245 @@
+// include/beman/execution/detail/filter_each.hpp                   -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef INCLUDED_BEMAN_EXECUTION_DETAIL_FILTER_EACH
+#define INCLUDED_BEMAN_EXECUTION_DETAIL_FILTER_EACH
+
+#include <beman/execution/detail/basic_sender.hpp>
+#include <beman/execution/detail/call_result_t.hpp>
+#include <beman/execution/detail/completion_signatures.hpp>
+#include <beman/execution/detail/completion_signatures_for.hpp>
+#include <beman/execution/detail/completion_signatures_of_t.hpp>
+#include <beman/execution/detail/connect.hpp>
+#include <beman/execution/detail/connect_result_t.hpp>
+#include <beman/execution/detail/default_impls.hpp>
+#include <beman/execution/detail/emplace_from.hpp>
+#include <beman/execution/detail/env_of_t.hpp>
+#include <beman/execution/detail/fwd_env.hpp>
+#include <beman/execution/detail/get_domain_early.hpp>
+#include <beman/execution/detail/get_env.hpp>
+#include <beman/execution/detail/immovable.hpp>
+#include <beman/execution/detail/impls_for.hpp>
+#include <beman/execution/detail/item_types_of_t.hpp>
+#include <beman/execution/detail/just.hpp>
+#include <beman/execution/detail/make_sender.hpp>
+#include <beman/execution/detail/meta_combine.hpp>
+#include <beman/execution/detail/meta_prepend.hpp>
+#include <beman/execution/detail/meta_to.hpp>
+#include <beman/execution/detail/meta_transform.hpp>
+#include <beman/execution/detail/meta_unique.hpp>
+#include <beman/execution/detail/movable_value.hpp>
+#include <beman/execution/detail/operation_state.hpp>
+#include <beman/execution/detail/receiver.hpp>
+#include <beman/execution/detail/sender.hpp>
+#include <beman/execution/detail/sender_adaptor.hpp>
+#include <beman/execution/detail/sender_adaptor_closure.hpp>
+#include <beman/execution/detail/sequence_sender.hpp>
+#include <beman/execution/detail/set_error.hpp>
+#include <beman/execution/detail/set_next.hpp>
+#include <beman/execution/detail/set_stopped.hpp>
+#include <beman/execution/detail/set_value.hpp>
+#include <beman/execution/detail/start.hpp>
+#include <beman/execution/detail/transform_sender.hpp>
+#include <beman/execution/detail/type_list.hpp>
+#include <exception>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+// ----------------------------------------------------------------------------
+
+#include <beman/execution/detail/suppress_push.hpp>
+
+namespace beman::execution::detail {
+struct filter_each_t : ::beman::execution::sender_adaptor_closure<filter_each_t> {
+    template <::beman::execution::detail::movable_value Pred>
+    auto operator()(Pred&& pred) const {
+        return ::beman::execution::detail::sender_adaptor{*this, ::std::forward<Pred>(pred)};
+    }
+    template <::beman::execution::sequence_sender Sender, ::beman::execution::detail::movable_value Pred>
+    auto operator()(Sender&& sender, Pred&& pred) const {
+        auto domain{::beman::execution::detail::get_domain_early(sender)};
+        return ::beman::execution::transform_sender(
+            domain,
+            ::beman::execution::detail::make_sender(
+                *this, ::std::forward<Pred>(pred), ::std::forward<Sender>(sender)));
+    }
+};
+
+template <>
+struct basic_sender_concept<::beman::execution::detail::filter_each_t> {
+    using type = ::beman::execution::sequence_sender_t;
+};
+
+template <typename Receiver, typename Inner, typename>
+struct filter_each_replay;
+template <typename Receiver, typename Inner, typename Tag, typename... Args>
+struct filter_each_replay<Receiver, Inner, Tag(Args...)> {
+    using type = ::beman::execution::connect_result_t<
+        ::beman::execution::detail::call_result_t<
+            ::beman::execution::set_next_t,
+            Receiver&,
+            ::beman::execution::detail::call_result_t<const ::beman::execution::detail::just_t<Tag>&, Args...>>,
+        Inner>;
+};
+
+/*!
+ * \brief Sender consuming one item of the sequence filtered by `filter_each`
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ * \internal
+ *
+ * \details
+ * The item is run and its values are checked using the predicate. Values
+ * satisfying the predicate, errors, and stop completions are passed on to
+ * the downstream receiver as `just(...)`, `just_error(...)`, or
+ * `just_stopped()`, respectively. Values not satisfying the predicate
+ * complete the sender immediately, requesting the next item.
+ */
+template <typename Item, typename Pred, typename Downstream>
+struct filter_each_next {
+    template <typename Receiver>
+    struct state : ::beman::execution::detail::immovable {
+        struct inner_receiver {
+            using receiver_concept = ::beman::execution::receiver_t;
+            using env_t            = ::beman::execution::detail::fwd_env<::beman::execution::env_of_t<Receiver>>;
+            state* st;
+
+            auto set_value() && noexcept -> void { ::beman::execution::set_value(::std::move(this->st->receiver)); }
+            auto set_stopped() && noexcept -> void { ::beman::execution::set_stopped(::std::move(this->st->receiver)); }
+            auto get_env() const noexcept -> env_t { return env_t(::beman::execution::get_env(this->st->receiver)); }
+        };
+        struct item_receiver {
+            using receiver_concept = ::beman::execution::receiver_t;
+            using env_t            = ::beman::execution::detail::fwd_env<::beman::execution::env_of_t<Receiver>>;
+            state* st;
+
+            template <typename... Args>
+            auto set_value(Args&&... args) && noexcept -> void {
+                bool keep{};
+                try {
+                    keep = ::std::invoke(*this->st->pred, ::std::as_const(args)...);
+                } catch (...) {
+                    this->st->replay(::beman::execution::just_error(::std::current_exception()));
+                    return;
+                }
+                if (keep)
+                    this->st->replay(::beman::execution::just(::std::forward<Args>(args)...));
+                else
+                    ::beman::execution::set_value(::std::move(this->st->receiver));
+            }
+            template <typename Error>
+            auto set_error(Error&& error) && noexcept -> void {
+                this->st->replay(::beman::execution::just_error(::std::forward<Error>(error)));
+            }
+            auto set_stopped() && noexcept -> void { this->st->replay(::beman::execution::just_stopped()); }
+            auto get_env() const noexcept -> env_t { return env_t(::beman::execution::get_env(this->st->receiver)); }
+        };
+
+        template <typename Sig>
+        using replay_t = typename ::beman::execution::detail::filter_each_replay<Downstream, inner_receiver, Sig>::type;
+        using replay_sigs_t = ::beman::execution::detail::meta::combine<
+            ::beman::execution::completion_signatures_of_t<Item, ::beman::execution::env_of_t<item_receiver>>,
+            ::beman::execution::completion_signatures<::beman::execution::set_error_t(::std::exception_ptr)>>;
+        using replay_ops_t = ::beman::execution::detail::meta::to<
+            ::std::variant,
+            ::beman::execution::detail::meta::prepend<
+                ::std::monostate,
+                ::beman::execution::detail::meta::unique<::beman::execution::detail::meta::transform<
+                    replay_t,
+                    ::beman::execution::detail::meta::to<::beman::execution::detail::type_list, replay_sigs_t>>>>>;
+
+        using operation_state_concept = ::beman::execution::operation_state_t;
+
+        Pred*                                                     pred;
+        Downstream*                                               downstream;
+        Receiver                                                  receiver;
+        ::beman::execution::connect_result_t<Item, item_receiver> op;
+        replay_ops_t                                              replay_op{};
+
+        template <typename R>
+        state(Item&& item, Pred* p, Downstream* d, R&& rcvr)
+            : pred(p),
+              downstream(d),
+              receiver(::std::forward<R>(rcvr)),
+              op(::beman::execution::connect(::std::move(item), item_receiver{this})) {}
+        auto start() & noexcept -> void { ::beman::execution::start(this->op); }
+
+        template <typename Sender>
+        auto replay(Sender&& sender) noexcept -> void {
+            using op_t = ::beman::execution::connect_result_t<
+                ::beman::execution::detail::call_result_t<::beman::execution::set_next_t, Downstream&, Sender>,
+                inner_receiver>;
+            try {
+                auto& next{this->replay_op.template emplace<op_t>(::beman::execution::detail::emplace_from([&] {
+                    return ::beman::execution::connect(
+                        ::beman::execution::set_next(*this->downstream, ::std::forward<Sender>(sender)),
+                        inner_receiver{this});
+                }))};
+                ::beman::execution::start(next);
+            } catch (...) {
+                ::beman::execution::set_stopped(::std::move(this->receiver));
+            }
+        }
+    };
+
+    using sender_concept = ::beman::execution::sender_t;
+    using completion_signatures =
+        ::beman::execution::completion_signatures<::beman::execution::set_value_t(),
+                                                  ::beman::execution::set_stopped_t()>;
+
+    Item        item;
+    Pred*       pred;
+    Downstream* downstream;
+
+    template <::beman::execution::receiver Receiver>
+    auto connect(Receiver&& receiver) && -> state<::std::remove_cvref_t<Receiver>> {
+        return {::std::move(this->item), this->pred, this->downstream, ::std::forward<Receiver>(receiver)};
+    }
+};
+
+template <>
+struct impls_for<::beman::execution::detail::filter_each_t> : ::beman::execution::detail::default_impls {
+    static constexpr auto next =
+        []<typename Pred, typename Receiver, typename Item>(auto, Pred& pred, Receiver& receiver, Item&& item) {
+            return ::beman::execution::detail::filter_each_next<::std::remove_cvref_t<Item>, Pred, Receiver>{
+                ::std::forward<Item>(item), &pred, &receiver};
+        };
+};
+
+template <typename Pred, typename Sender, typename Env>
+struct completion_signatures_for_impl<
+    ::beman::execution::detail::basic_sender<::beman::execution::detail::filter_each_t, Pred, Sender>,
+    Env> {
+    using type = ::beman::execution::completion_signatures_of_t<Sender, Env>;
+};
+
+template <typename Pred, typename Sender, typename Env>
+struct item_types_for_impl<
+    ::beman::execution::detail::basic_sender<::beman::execution::detail::filter_each_t, Pred, Sender>,
+    Env> {
+    using type = ::beman::execution::detail::meta::unique<::beman::execution::detail::meta::combine<
+        ::beman::execution::item_types_of_t<Sender, Env>,
+        ::beman::execution::completion_signatures<::beman::execution::set_error_t(::std::exception_ptr)>>>;
+};
+} // namespace beman::execution::detail
+
+#include <beman/execution/detail/suppress_pop.hpp>
+
+namespace beman::execution {
+using filter_each_t = ::beman::execution::detail::filter_each_t;
+/*!
+ * \brief `filter_each(sequence, pred)` passes on only the items of `sequence` whose values satisfy `pred`
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ *
+ * \details
+ * Items are run to evaluate `pred` with their values. Items whose values
+ * don't satisfy `pred` are consumed without reaching the downstream receiver.
+ * The other items, errors of items, and errors thrown by `pred` are passed on.
+ */
+inline constexpr ::beman::execution::filter_each_t filter_each{};
+} // namespace beman::execution
+
+// ----------------------------------------------------------------------------
+
+#endif
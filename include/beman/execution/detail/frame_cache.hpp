@@ -0,0 +1,97 @@
+// include/beman/execution/detail/frame_cache.hpp                   -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef INCLUDED_BEMAN_EXECUTION_DETAIL_FRAME_CACHE
+#define INCLUDED_BEMAN_EXECUTION_DETAIL_FRAME_CACHE
+
+#include <array>
+#include <cstddef>
+#include <new>
+
+// ----------------------------------------------------------------------------
+
+namespace beman::execution::detail {
+/*!
+ * \brief Thread-local cache recycling memory for coroutine frames
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ * \internal
+ *
+ * \details
+ * Sizes up to `class_count * granularity` bytes are rounded up to a multiple
+ * of `granularity` and released blocks are kept on a per-thread free list for
+ * their size class, holding at most `class_capacity` blocks each. Thus,
+ * repeatedly creating similar frames doesn't hit the global heap after
+ * warming up. Larger sizes and blocks exceeding the capacity use the global
+ * `operator new` and `operator delete` which also provide the blocks being
+ * cached, i.e., blocks may be released on a different thread.
+ */
+class frame_cache {
+  public:
+    static constexpr ::std::size_t granularity{64u};
+    static constexpr ::std::size_t class_count{16u};
+    static constexpr ::std::size_t class_capacity{16u};
+
+    static auto allocate(::std::size_t size) -> void* {
+        if (size == 0u || class_count * granularity < size)
+            return ::operator new(size);
+        bucket& b{local().buckets[size_class(size)]};
+        if (block* head{b.head}) {
+            b.head = head->next;
+            --b.count;
+            return head;
+        }
+        return ::operator new(class_size(size));
+    }
+    static auto deallocate(void* ptr, ::std::size_t size) noexcept -> void {
+        if (size == 0u || class_count * granularity < size) {
+            ::operator delete(ptr);
+            return;
+        }
+        bucket& b{local().buckets[size_class(size)]};
+        if (b.count == class_capacity) {
+            ::operator delete(ptr);
+            return;
+        }
+        b.head = ::new (ptr) block{b.head};
+        ++b.count;
+    }
+
+  private:
+    struct block {
+        block* next;
+    };
+    struct bucket {
+        block*        head{};
+        ::std::size_t count{};
+    };
+    struct cache {
+        ::std::array<bucket, class_count> buckets{};
+
+        cache() = default;
+        cache(const cache&) = delete;
+        ~cache() {
+            for (bucket& b : this->buckets)
+                while (block* head{b.head}) {
+                    b.head = head->next;
+                    ::operator delete(head);
+                }
+        }
+        auto operator=(const cache&) -> cache& = delete;
+    };
+
+    static auto local() noexcept -> cache& {
+        static thread_local cache rc{};
+        return rc;
+    }
+    static constexpr auto size_class(::std::size_t size) noexcept -> ::std::size_t {
+        return (size - 1u) / granularity;
+    }
+    static constexpr auto class_size(::std::size_t size) noexcept -> ::std::size_t {
+        return (size_class(size) + 1u) * granularity;
+    }
+};
+} // namespace beman::execution::detail
+
+// ----------------------------------------------------------------------------
+
+#endif
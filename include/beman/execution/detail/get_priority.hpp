@@ -0,0 +1,39 @@
+// include/beman/execution/detail/get_priority.hpp                  -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef INCLUDED_BEMAN_EXECUTION_DETAIL_GET_PRIORITY
+#define INCLUDED_BEMAN_EXECUTION_DETAIL_GET_PRIORITY
+
+#include <beman/execution/detail/forwarding_query.hpp>
+#include <concepts>
+#include <utility>
+
+// ----------------------------------------------------------------------------
+
+namespace beman::execution {
+/*!
+ * \brief The priority lanes used by priority aware execution contexts
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ */
+enum class priority : unsigned char { high, normal, low };
+
+/*!
+ * \brief Query used to obtain the priority work should be scheduled with
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ */
+struct get_priority_t : ::beman::execution::forwarding_query_t {
+    template <typename Env>
+        requires requires(Env&& env, const get_priority_t& self) {
+            { ::std::as_const(env).query(self) } noexcept -> ::std::convertible_to<::beman::execution::priority>;
+        }
+    auto operator()(Env&& env) const noexcept -> ::beman::execution::priority {
+        return ::std::as_const(env).query(*this);
+    }
+};
+
+inline constexpr get_priority_t get_priority{};
+} // namespace beman::execution
+
+// ----------------------------------------------------------------------------
+
+#endif
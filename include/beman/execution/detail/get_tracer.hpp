@@ -0,0 +1,50 @@
+// include/beman/execution/detail/get_tracer.hpp                    -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef INCLUDED_BEMAN_EXECUTION_DETAIL_GET_TRACER
+#define INCLUDED_BEMAN_EXECUTION_DETAIL_GET_TRACER
+
+#include <beman/execution/detail/forwarding_query.hpp>
+#include <utility>
+
+// ----------------------------------------------------------------------------
+
+namespace beman::execution {
+/*!
+ * \brief Query used to obtain a tracer from an environment
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ *
+ * \details
+ * If the environment of the receiver a library sender is connected to provides
+ * `get_tracer`, the resulting operation state reports events to the returned tracer:
+ *
+ * - `tracer.on_start(tag, op, time)` right before the operation is started
+ * - `tracer.on_complete(tag, completion, op, time)` right before the operation
+ *   delivers its completion to its receiver
+ *
+ * Each start is matched by exactly one completion with the same `tag` and `op`,
+ * for leaf senders like `just` as well as for adaptors like `then`.
+ *
+ * `tag` is the algorithm tag (e.g. `then_t`), `completion` is one of `set_value_t`,
+ * `set_error_t`, or `set_stopped_t`, `op` is a `const void*` identifying the
+ * operation state, and `time` is a `std::chrono::steady_clock::time_point`.
+ * The tracer is obtained for each event and should be a cheap handle, e.g., a
+ * pointer to the actual recorder. When the query isn't available no code is
+ * generated for the events.
+ */
+struct get_tracer_t : ::beman::execution::forwarding_query_t {
+    template <typename Env>
+        requires requires(Env&& env, const get_tracer_t& self) {
+            { ::std::as_const(env).query(self) } noexcept;
+        }
+    auto operator()(Env&& env) const noexcept {
+        return ::std::as_const(env).query(*this);
+    }
+};
+
+inline constexpr get_tracer_t get_tracer{};
+} // namespace beman::execution
+
+// ----------------------------------------------------------------------------
+
+#endif
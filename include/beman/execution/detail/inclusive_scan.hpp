@@ -0,0 +1,124 @@
+// include/beman/execution/detail/inclusive_scan.hpp                -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef INCLUDED_BEMAN_EXECUTION_DETAIL_INCLUSIVE_SCAN
+#define INCLUDED_BEMAN_EXECUTION_DETAIL_INCLUSIVE_SCAN
+
+#include <beman/execution/detail/parallel_chunks.hpp>
+#include <beman/execution/detail/scheduler.hpp>
+#include <beman/execution/detail/set_value.hpp>
+
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <optional>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// ----------------------------------------------------------------------------
+
+namespace beman::execution::detail {
+/*!
+ * \brief The two phases of a parallel inclusive scan
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ * \internal
+ *
+ * \details
+ * The first phase scans each chunk independently into the output and records
+ * the chunk totals. Between the phases the exclusive prefixes of the chunk
+ * totals are computed serially, one value per chunk. The second phase
+ * combines each element of a chunk with the prefix of that chunk; the first
+ * chunk is already complete.
+ */
+template <typename Range, typename Out, typename Op>
+struct inclusive_scan_algo {
+    using value_type = ::std::iter_value_t<Out>;
+    static constexpr ::std::size_t phases{2u};
+    using value_signature = ::beman::execution::set_value_t(Out);
+
+    Range                                       range;
+    Out                                         out;
+    Op                                          op;
+    ::std::vector<::std::optional<value_type>> totals{};
+
+    auto size() -> ::std::size_t { return ::std::size_t(::std::ranges::size(this->range)); }
+    auto prepare(::std::size_t chunks) -> void { this->totals.resize(chunks); }
+    auto run(::std::size_t phase, ::std::size_t chunk, ::std::size_t first, ::std::size_t last) -> void {
+        if (first == last)
+            return;
+        if (phase == 0u) {
+            auto begin{::beman::execution::detail::parallel_begin(this->range)};
+            ::std::inclusive_scan(begin + first, begin + last, this->out + first, ::std::ref(this->op));
+            this->totals[chunk].emplace(this->out[last - 1u]);
+        } else if (this->totals[chunk]) {
+            const value_type& prefix{*this->totals[chunk]};
+            for (auto it{this->out + first}, end{this->out + last}; it != end; ++it)
+                *it = ::std::invoke(this->op, prefix, ::std::move(*it));
+        }
+    }
+    auto finish(::std::size_t phase) -> bool {
+        if (phase != 0u || this->totals.size() < 2u)
+            return false;
+        // replace the totals by the exclusive prefixes; the first chunk needs none
+        ::std::optional<value_type> prefix{};
+        for (auto& total : this->totals) {
+            ::std::optional<value_type> next{};
+            if (total)
+                next.emplace(prefix ? value_type(::std::invoke(this->op, *prefix, ::std::move(*total)))
+                                    : ::std::move(*total));
+            else
+                next = prefix;
+            total  = ::std::move(prefix);
+            prefix = ::std::move(next);
+        }
+        return true;
+    }
+    template <typename Receiver>
+    auto complete(Receiver&& receiver) noexcept -> void {
+        ::beman::execution::set_value(::std::forward<Receiver>(receiver),
+                                      this->out + ::std::iter_difference_t<Out>(this->size()));
+    }
+};
+
+struct inclusive_scan_t {
+    template <::beman::execution::scheduler Scheduler,
+              ::std::ranges::random_access_range Range,
+              ::std::random_access_iterator     Out,
+              typename Op = ::std::plus<>>
+        requires ::std::ranges::sized_range<Range> && ::std::ranges::viewable_range<Range> &&
+                 ::std::indirectly_writable<Out, ::std::ranges::range_reference_t<Range>>
+    auto operator()(Scheduler&& scheduler, Range&& range, Out out, Op&& op = {}) const {
+        using algo_t = ::beman::execution::detail::
+            inclusive_scan_algo<::std::views::all_t<Range>, Out, ::std::decay_t<Op>>;
+        return ::beman::execution::detail::parallel_chunks_sender<::std::remove_cvref_t<Scheduler>, algo_t>{
+            ::std::forward<Scheduler>(scheduler),
+            algo_t{::std::views::all(::std::forward<Range>(range)), ::std::move(out), ::std::forward<Op>(op)}};
+    }
+};
+} // namespace beman::execution::detail
+
+namespace beman::execution {
+using inclusive_scan_t = ::beman::execution::detail::inclusive_scan_t;
+/*!
+ * \brief Sender factory computing the inclusive prefix sums of a range in parallel
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ *
+ * \details
+ * `inclusive_scan(sch, range, out, op = std::plus<>())` writes the inclusive
+ * scan of the random-access `range` using the associative operation `op` to
+ * the random-access iterator `out` and completes with `set_value(out + n)`.
+ * The work is done in two passes over chunks scheduled on `sch`: the first
+ * scans each chunk independently, the second adds the total of all preceding
+ * chunks to the elements of each chunk. Errors complete with
+ * `set_error(std::exception_ptr)`, stopped chunks with `set_stopped()`.
+ */
+inline constexpr inclusive_scan_t inclusive_scan{};
+} // namespace beman::execution
+
+// ----------------------------------------------------------------------------
+
+#endif
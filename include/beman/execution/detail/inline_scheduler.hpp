@@ -0,0 +1,70 @@
+// include/beman/execution/detail/inline_scheduler.hpp              -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef INCLUDED_BEMAN_EXECUTION_DETAIL_INLINE_SCHEDULER
+#define INCLUDED_BEMAN_EXECUTION_DETAIL_INLINE_SCHEDULER
+
+#include <beman/execution/detail/completion_signatures.hpp>
+#include <beman/execution/detail/get_completion_scheduler.hpp>
+#include <beman/execution/detail/operation_state.hpp>
+#include <beman/execution/detail/receiver.hpp>
+#include <beman/execution/detail/scheduler.hpp>
+#include <beman/execution/detail/sender.hpp>
+#include <beman/execution/detail/set_value.hpp>
+
+#include <type_traits>
+#include <utility>
+
+// ----------------------------------------------------------------------------
+
+namespace beman::execution {
+/*!
+ * \brief Scheduler completing `schedule()` immediately on the thread calling `start()`
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ *
+ * \details
+ * The scheduler and its sender are empty and all `inline_scheduler`s compare
+ * equal. The operation state only holds the receiver and `start()` calls
+ * `set_value()` directly, i.e., scheduling on it costs nothing beyond the
+ * completion itself.
+ */
+struct inline_scheduler {
+  private:
+    struct env {
+        template <typename Completion>
+        constexpr auto query(const ::beman::execution::get_completion_scheduler_t<Completion>&) const noexcept
+            -> inline_scheduler {
+            return {};
+        }
+    };
+    template <typename Receiver>
+    struct state {
+        using operation_state_concept = ::beman::execution::operation_state_t;
+        Receiver receiver;
+
+        auto start() & noexcept -> void { ::beman::execution::set_value(::std::move(this->receiver)); }
+    };
+    struct sender {
+        using sender_concept        = ::beman::execution::sender_t;
+        using completion_signatures = ::beman::execution::completion_signatures<::beman::execution::set_value_t()>;
+
+        constexpr auto get_env() const noexcept -> env { return {}; }
+        template <::beman::execution::receiver Receiver>
+        auto connect(Receiver&& receiver) const
+            noexcept(::std::is_nothrow_constructible_v<::std::remove_cvref_t<Receiver>, Receiver>)
+                -> state<::std::remove_cvref_t<Receiver>> {
+            return {::std::forward<Receiver>(receiver)};
+        }
+    };
+
+  public:
+    using scheduler_concept = ::beman::execution::scheduler_t;
+
+    constexpr auto schedule() const noexcept -> sender { return {}; }
+    constexpr auto operator==(const inline_scheduler&) const noexcept -> bool = default;
+};
+} // namespace beman::execution
+
+// ----------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,45 @@
+// include/beman/execution/detail/item_types_of_t.hpp               -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef INCLUDED_BEMAN_EXECUTION_DETAIL_ITEM_TYPES_OF
+#define INCLUDED_BEMAN_EXECUTION_DETAIL_ITEM_TYPES_OF
+
+#include <beman/execution/detail/empty_env.hpp>
+#include <beman/execution/detail/sequence_sender.hpp>
+#include <type_traits>
+
+// ----------------------------------------------------------------------------
+
+namespace beman::execution::detail {
+/*!
+ * \brief Primary template declaration for the customization of sequence item types.
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ * \internal
+ */
+template <typename Sender, typename Env>
+struct item_types_for_impl;
+
+template <typename Sender, typename Env>
+struct item_types_of {
+    using type = typename ::beman::execution::detail::item_types_for_impl<Sender, Env>::type;
+};
+template <typename Sender, typename Env>
+    requires requires { typename Sender::item_types; }
+struct item_types_of<Sender, Env> {
+    using type = typename Sender::item_types;
+};
+} // namespace beman::execution::detail
+
+namespace beman::execution {
+/*!
+ * \brief Alias to access the completion signatures of the items of a sequence sender
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ */
+template <typename Sender, typename Env = ::beman::execution::empty_env>
+    requires ::beman::execution::sequence_sender<Sender>
+using item_types_of_t = typename ::beman::execution::detail::item_types_of<::std::remove_cvref_t<Sender>, Env>::type;
+} // namespace beman::execution
+
+// ----------------------------------------------------------------------------
+
+#endif
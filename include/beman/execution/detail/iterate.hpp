@@ -0,0 +1,180 @@
+// include/beman/execution/detail/iterate.hpp                       -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef INCLUDED_BEMAN_EXECUTION_DETAIL_ITERATE
+#define INCLUDED_BEMAN_EXECUTION_DETAIL_ITERATE
+
+#include <beman/execution/detail/basic_sender.hpp>
+#include <beman/execution/detail/call_result_t.hpp>
+#include <beman/execution/detail/completion_signatures.hpp>
+#include <beman/execution/detail/completion_signatures_for.hpp>
+#include <beman/execution/detail/connect.hpp>
+#include <beman/execution/detail/connect_result_t.hpp>
+#include <beman/execution/detail/default_impls.hpp>
+#include <beman/execution/detail/emplace_from.hpp>
+#include <beman/execution/detail/env_of_t.hpp>
+#include <beman/execution/detail/forward_like.hpp>
+#include <beman/execution/detail/fwd_env.hpp>
+#include <beman/execution/detail/get_env.hpp>
+#include <beman/execution/detail/get_stop_token.hpp>
+#include <beman/execution/detail/immovable.hpp>
+#include <beman/execution/detail/impls_for.hpp>
+#include <beman/execution/detail/item_types_of_t.hpp>
+#include <beman/execution/detail/just.hpp>
+#include <beman/execution/detail/make_sender.hpp>
+#include <beman/execution/detail/movable_value.hpp>
+#include <beman/execution/detail/receiver.hpp>
+#include <beman/execution/detail/sequence_sender.hpp>
+#include <beman/execution/detail/set_error.hpp>
+#include <beman/execution/detail/set_next.hpp>
+#include <beman/execution/detail/set_stopped.hpp>
+#include <beman/execution/detail/set_value.hpp>
+#include <beman/execution/detail/start.hpp>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <optional>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+// ----------------------------------------------------------------------------
+
+#include <beman/execution/detail/suppress_push.hpp>
+
+namespace beman::execution::detail {
+struct iterate_t {
+    template <::std::ranges::input_range Range>
+        requires ::std::ranges::viewable_range<Range> &&
+                 ::beman::execution::detail::movable_value<::std::ranges::range_reference_t<Range>>
+    auto operator()(Range&& range) const {
+        return ::beman::execution::detail::make_sender(*this, ::std::views::all(::std::forward<Range>(range)));
+    }
+};
+
+template <>
+struct basic_sender_concept<::beman::execution::detail::iterate_t> {
+    using type = ::beman::execution::sequence_sender_t;
+};
+
+/*!
+ * \brief Operation state of `iterate(range)` passing one element at a time to the receiver
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ * \internal
+ *
+ * \details
+ * The sender returned from `set_next()` for an element is started only after
+ * the sender for the previous element completed. Elements completing
+ * synchronously are handled in a loop rather than recursively: `step()`
+ * counts the pending steps and only the call seeing no pending step drives
+ * the loop.
+ */
+template <typename View, typename Receiver>
+struct iterate_state : ::beman::execution::detail::immovable {
+    using item_t = ::beman::execution::detail::call_result_t<const ::beman::execution::just_t&,
+                                                             ::std::ranges::range_reference_t<View>>;
+    struct next_receiver {
+        using receiver_concept = ::beman::execution::receiver_t;
+        using env_t            = ::beman::execution::detail::fwd_env<::beman::execution::env_of_t<Receiver>>;
+        iterate_state* state;
+
+        auto set_value() && noexcept -> void { this->state->step(); }
+        auto set_stopped() && noexcept -> void {
+            this->state->stopped = true;
+            this->state->step();
+        }
+        auto get_env() const noexcept -> env_t { return env_t(::beman::execution::get_env(*this->state->receiver)); }
+    };
+    using next_t =
+        ::beman::execution::connect_result_t<::beman::execution::detail::call_result_t<::beman::execution::set_next_t,
+                                                                                       Receiver&,
+                                                                                       item_t>,
+                                             next_receiver>;
+
+    View                            view;
+    ::std::ranges::iterator_t<View> it;
+    Receiver*                       receiver;
+    ::std::atomic<::std::size_t>    pending{};
+    bool                            stopped{};
+    ::std::optional<next_t>         op{};
+
+    iterate_state(View v, Receiver& r) : view(::std::move(v)), it(::std::ranges::begin(this->view)), receiver(&r) {}
+
+    auto step() noexcept -> void {
+        if (this->pending.fetch_add(1u, ::std::memory_order_acq_rel) != 0u)
+            return;
+        do {
+            if (this->stopped ||
+                ::beman::execution::get_stop_token(::beman::execution::get_env(*this->receiver)).stop_requested()) {
+                ::beman::execution::set_stopped(::std::move(*this->receiver));
+                return;
+            }
+            if (this->it == ::std::ranges::end(this->view)) {
+                ::beman::execution::set_value(::std::move(*this->receiver));
+                return;
+            }
+            try {
+                this->op.emplace(::beman::execution::detail::emplace_from([this] {
+                    return ::beman::execution::connect(
+                        ::beman::execution::set_next(*this->receiver, ::beman::execution::just(*this->it)),
+                        next_receiver{this});
+                }));
+            } catch (...) {
+                ::beman::execution::set_error(::std::move(*this->receiver), ::std::current_exception());
+                return;
+            }
+            ++this->it;
+            ::beman::execution::start(*this->op);
+        } while (this->pending.fetch_sub(1u, ::std::memory_order_acq_rel) != 1u);
+    }
+};
+
+template <>
+struct impls_for<::beman::execution::detail::iterate_t> : ::beman::execution::detail::default_impls {
+    static constexpr auto get_state = []<typename Sender, typename Receiver>(Sender&& sender, Receiver& receiver) {
+        using view_t = ::std::remove_cvref_t<decltype(sender.template get<1>())>;
+        return ::beman::execution::detail::iterate_state<view_t, Receiver>(
+            ::beman::execution::detail::forward_like<Sender>(sender.template get<1>()), receiver);
+    };
+    static constexpr auto start = [](auto& state, auto&) noexcept -> void { state.step(); };
+};
+
+template <typename View, typename Env>
+struct completion_signatures_for_impl<
+    ::beman::execution::detail::basic_sender<::beman::execution::detail::iterate_t, View>,
+    Env> {
+    using type = ::beman::execution::completion_signatures<::beman::execution::set_value_t(),
+                                                           ::beman::execution::set_error_t(::std::exception_ptr),
+                                                           ::beman::execution::set_stopped_t()>;
+};
+
+template <typename View, typename Env>
+struct item_types_for_impl<::beman::execution::detail::basic_sender<::beman::execution::detail::iterate_t, View>,
+                           Env> {
+    using type = ::beman::execution::completion_signatures<::beman::execution::set_value_t(
+        ::std::decay_t<::std::ranges::range_reference_t<View>>)>;
+};
+} // namespace beman::execution::detail
+
+#include <beman/execution/detail/suppress_pop.hpp>
+
+namespace beman::execution {
+using iterate_t = ::beman::execution::detail::iterate_t;
+/*!
+ * \brief `iterate(range)` yields a sequence sender producing the elements of `range`
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ *
+ * \details
+ * Each element is passed to the receiver as `just(element)` using
+ * `set_next()`. The sequence completes with `set_value()` after the last
+ * element was consumed, with `set_stopped()` if a consumer completes with
+ * `set_stopped()` or stop is requested, and with `set_error()` if obtaining
+ * the consumer's sender throws. An lvalue `range` is referenced, an rvalue
+ * `range` is moved into the sender.
+ */
+inline constexpr ::beman::execution::iterate_t iterate{};
+} // namespace beman::execution
+
+// ----------------------------------------------------------------------------
+
+#endif
@@ -10,6 +10,25 @@
 // ----------------------------------------------------------------------------
 
 namespace beman::execution::detail::meta::detail {
+//! Concatenation of type_lists used in unevaluated folds only.
+template <typename... T0, typename... T1>
+auto operator+(::beman::execution::detail::type_list<T0...>, ::beman::execution::detail::type_list<T1...>)
+    -> ::beman::execution::detail::type_list<T0..., T1...>;
+
+template <typename>
+struct as_type_list;
+template <template <typename...> class L, typename... T>
+struct as_type_list<L<T...>> {
+    using type = ::beman::execution::detail::type_list<T...>;
+};
+
+template <template <typename...> class, typename>
+struct rebind_list;
+template <template <typename...> class L, typename... T>
+struct rebind_list<L, ::beman::execution::detail::type_list<T...>> {
+    using type = L<T...>;
+};
+
 template <typename...>
 struct combine;
 
@@ -17,13 +36,36 @@ template <template <typename...> class L0, typename... T0>
 struct combine<L0<T0...>> {
     using type = L0<T0...>;
 };
+template <template <typename...> class L0, typename... T0, template <typename...> class L1, typename... T1>
+struct combine<L0<T0...>, L1<T1...>> {
+    using type = L0<T0..., T1...>;
+};
 template <template <typename...> class L0,
           typename... T0,
           template <typename...> class L1,
           typename... T1,
-          typename... L>
-struct combine<L0<T0...>, L1<T1...>, L...> {
-    using type = typename combine<L0<T0..., T1...>, L...>::type;
+          template <typename...> class L2,
+          typename... T2>
+struct combine<L0<T0...>, L1<T1...>, L2<T2...>> {
+    using type = L0<T0..., T1..., T2...>;
+};
+/*!
+ * \brief Concatenates lists into a list of the first list's template
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ * \internal
+ *
+ * \details
+ * More than three lists are concatenated by a fold expression over
+ * `type_list`s rather than by recursive instantiations. Only the result is
+ * instantiated using the list template of the first list.
+ */
+template <template <typename...> class L0, typename... T0, typename... L>
+    requires(2u < sizeof...(L))
+struct combine<L0<T0...>, L...> {
+    using type = typename ::beman::execution::detail::meta::detail::rebind_list<
+        L0,
+        decltype((::beman::execution::detail::type_list<T0...>{} + ... +
+                  typename ::beman::execution::detail::meta::detail::as_type_list<L>::type{}))>::type;
 };
 } // namespace beman::execution::detail::meta::detail
 
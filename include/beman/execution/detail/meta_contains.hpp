@@ -9,8 +9,13 @@
 // ----------------------------------------------------------------------------
 
 namespace beman::execution::detail::meta {
+#if defined(__GNUC__) || defined(__clang__)
+template <typename T, typename... S>
+inline constexpr bool contains{(__is_same(T, S) || ...)};
+#else
 template <typename T, typename... S>
 inline constexpr bool contains{(::std::same_as<T, S> || ...)};
+#endif
 }
 
 // ----------------------------------------------------------------------------
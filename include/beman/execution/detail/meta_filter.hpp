@@ -4,7 +4,7 @@
 #ifndef INCLUDED_BEMAN_EXECUTION_DETAIL_META_FILTER
 #define INCLUDED_BEMAN_EXECUTION_DETAIL_META_FILTER
 
-#include <beman/execution/detail/meta_prepend.hpp>
+#include <beman/execution/detail/meta_select.hpp>
 #include <type_traits>
 
 // ----------------------------------------------------------------------------
@@ -16,31 +16,17 @@ struct filter;
 template <template <typename, typename> class, typename, typename>
 struct filter_tag;
 
-template <template <typename> class Predicate, template <typename...> class List>
-struct filter<Predicate, List<>> {
-    using type = List<>;
-};
-
-template <template <typename, typename> class Predicate, typename Tag, template <typename...> class List>
-struct filter_tag<Predicate, Tag, List<>> {
-    using type = List<>;
-};
-
-template <template <typename> class Predicate, template <typename...> class List, typename H, typename... T>
-struct filter<Predicate, List<H, T...>> {
-    using tail = typename beman::execution::detail::meta::detail::filter<Predicate, List<T...>>::type;
-    using type = ::std::conditional_t<Predicate<H>::value, ::beman::execution::detail::meta::prepend<H, tail>, tail>;
+template <template <typename> class Predicate, template <typename...> class List, typename... T>
+struct filter<Predicate, List<T...>> {
+    using type = ::beman::execution::detail::meta::select<List<T...>, bool(Predicate<T>::value)...>;
 };
 
 template <template <typename, typename> class Predicate,
           typename Tag,
           template <typename...> class List,
-          typename H,
           typename... T>
-struct filter_tag<Predicate, Tag, List<H, T...>> {
-    using tail = typename beman::execution::detail::meta::detail::filter_tag<Predicate, Tag, List<T...>>::type;
-    using type =
-        ::std::conditional_t<Predicate<Tag, H>::value, ::beman::execution::detail::meta::prepend<H, tail>, tail>;
+struct filter_tag<Predicate, Tag, List<T...>> {
+    using type = ::beman::execution::detail::meta::select<List<T...>, bool(Predicate<Tag, T>::value)...>;
 };
 } // namespace beman::execution::detail::meta::detail
 
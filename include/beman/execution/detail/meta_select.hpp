@@ -0,0 +1,44 @@
+// include/beman/execution/detail/meta_select.hpp                   -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef INCLUDED_BEMAN_EXECUTION_DETAIL_META_SELECT
+#define INCLUDED_BEMAN_EXECUTION_DETAIL_META_SELECT
+
+#include <beman/execution/detail/meta_combine.hpp>
+#include <beman/execution/detail/type_list.hpp>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+// ----------------------------------------------------------------------------
+
+namespace beman::execution::detail::meta::detail {
+template <typename List, bool... Keep>
+struct select;
+template <template <typename...> class List, typename... T, bool... Keep>
+struct select<List<T...>, Keep...> {
+    template <bool K, typename E>
+    using keep =
+        ::std::conditional_t<K, ::beman::execution::detail::type_list<E>, ::beman::execution::detail::type_list<>>;
+    using type = ::beman::execution::detail::meta::combine<List<>, keep<Keep, T>...>;
+};
+} // namespace beman::execution::detail::meta::detail
+
+namespace beman::execution::detail::meta {
+/*!
+ * \brief The list `List<T...>` restricted to the elements `T[i]` with `Keep[i] == true`
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ * \internal
+ *
+ * \details
+ * The flags `Keep...` are typically computed from a predicate by a single
+ * pack expansion. The kept elements are concatenated by `meta::combine`
+ * without recursively instantiating partial lists.
+ */
+template <typename List, bool... Keep>
+using select = typename ::beman::execution::detail::meta::detail::select<List, Keep...>::type;
+} // namespace beman::execution::detail::meta
+
+// ----------------------------------------------------------------------------
+
+#endif
@@ -4,26 +4,31 @@
 #ifndef INCLUDED_BEMAN_EXECUTION_DETAIL_NOTIFY
 #define INCLUDED_BEMAN_EXECUTION_DETAIL_NOTIFY
 
+#include <beman/execution/detail/atomic_intrusive_stack.hpp>
 #include <beman/execution/detail/make_sender.hpp>
 #include <beman/execution/detail/immovable.hpp>
-#include <mutex>
 #include <utility>
 
 // ----------------------------------------------------------------------------
 
 namespace beman::execution::detail {
 struct notify_t;
+/*!
+ * \brief Lock-free one-shot notification whose waiters are operation states
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ * \internal
+ *
+ * \details
+ * Waiters are pushed onto an atomic intrusive stack; `complete()` closes the
+ * stack and completes all waiters. Waiters added after `complete()` fail to
+ * get pushed onto the closed stack and complete immediately.
+ */
 class notifier : ::beman::execution::detail::immovable {
   public:
     auto complete() -> void {
-        ::std::unique_lock kerberos(this->lock);
-        this->completed = true;
-        while (this->head) {
-            auto* next{::std::exchange(this->head, this->head->next)};
-            kerberos.unlock();
+        auto waiters{this->waiters.pop_all_and_shutdown()};
+        while (auto* next{waiters.pop()})
             next->complete();
-            kerberos.lock();
-        }
     }
 
   private:
@@ -32,17 +37,9 @@ class notifier : ::beman::execution::detail::immovable {
         base*        next{};
         virtual auto complete() -> void = 0;
     };
-    std::mutex lock;
-    bool       completed{};
-    base*      head{};
+    ::beman::execution::detail::atomic_intrusive_stack<&base::next> waiters{};
 
-    auto add(base* b) -> bool {
-        ::std::lock_guard kerberbos(this->lock);
-        if (this->completed)
-            return false;
-        b->next = std::exchange(this->head, b);
-        return true;
-    }
+    auto add(base* b) -> bool { return this->waiters.try_push(b).has_value(); }
 };
 
 struct notify_t {
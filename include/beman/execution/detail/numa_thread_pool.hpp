@@ -0,0 +1,417 @@
+// include/beman/execution/detail/numa_thread_pool.hpp              -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef INCLUDED_BEMAN_EXECUTION_DETAIL_NUMA_THREAD_POOL
+#define INCLUDED_BEMAN_EXECUTION_DETAIL_NUMA_THREAD_POOL
+
+#include <beman/execution/detail/completion_signatures.hpp>
+#include <beman/execution/detail/get_completion_scheduler.hpp>
+#include <beman/execution/detail/get_env.hpp>
+#include <beman/execution/detail/get_stop_token.hpp>
+#include <beman/execution/detail/immovable.hpp>
+#include <beman/execution/detail/operation_state.hpp>
+#include <beman/execution/detail/scheduler.hpp>
+#include <beman/execution/detail/sender.hpp>
+#include <beman/execution/detail/set_stopped.hpp>
+#include <beman/execution/detail/set_value.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+// ----------------------------------------------------------------------------
+
+namespace beman::execution::detail {
+//! Parses a Linux CPU list like `0-3,8,10-11` into the listed CPU numbers; malformed parts are skipped.
+inline auto numa_parse_cpu_list(::std::string_view list) -> ::std::vector<int> {
+    ::std::vector<int> cpus;
+    auto               number{[&list]() -> int {
+        int value{-1};
+        while (not list.empty() && '0' <= list.front() && list.front() <= '9') {
+            value = (value < 0 ? 0 : value * 10) + (list.front() - '0');
+            list.remove_prefix(1u);
+        }
+        return value;
+    }};
+    while (not list.empty()) {
+        int first{number()};
+        int last{first};
+        if (not list.empty() && list.front() == '-') {
+            list.remove_prefix(1u);
+            last = number();
+        }
+        if (0 <= first && first <= last)
+            for (int cpu{first}; cpu <= last; ++cpu)
+                cpus.push_back(cpu);
+        while (not list.empty() && (list.front() < '0' || '9' < list.front()))
+            list.remove_prefix(1u);
+    }
+    return cpus;
+}
+} // namespace beman::execution::detail
+
+namespace beman::execution {
+//! A NUMA node as used by `numa_thread_pool`: its number and the CPUs belonging to it.
+struct numa_node {
+    ::std::size_t      id{};
+    ::std::vector<int> cpus{};
+};
+
+/*!
+ * \brief Thread pool grouping its workers by NUMA node
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ *
+ * \details
+ * The pool creates a group of workers for each `numa_node`, by default one
+ * worker per CPU of the nodes found by `topology()`, and optionally pins each
+ * worker to the CPUs of its node or to a single CPU. Every worker owns an
+ * intrusive FIFO queue. A worker without work first steals from the workers
+ * of its own node and only then from other nodes, i.e., work crosses nodes
+ * only when a node runs out of work while another one has a backlog.
+ *
+ * `get_scheduler(node)` yields a scheduler whose work is queued on the
+ * workers of `node`: when scheduling from one of these workers the work is
+ * queued on that worker, otherwise the node's workers are used round-robin.
+ * `get_scheduler()` yields the scheduler of the calling worker's node when
+ * called from a worker and a scheduler distributing work across all nodes
+ * otherwise. Thus `starts_on(pool.get_scheduler(n), sndr)` and
+ * `continues_on(pool.get_scheduler())` keep work on one node.
+ *
+ * The destructor executes the work already scheduled and joins the
+ * workers; no work may be scheduled once destruction started.
+ */
+class numa_thread_pool : ::beman::execution::detail::immovable {
+  public:
+    //! How workers are bound to CPUs.
+    enum class pinning : unsigned char { none, node, cpu };
+    static constexpr ::std::size_t any_node{::std::numeric_limits<::std::size_t>::max()};
+
+  private:
+    struct opstate_base : ::beman::execution::detail::virtual_immovable {
+        opstate_base* next{};
+        virtual auto  execute() noexcept -> void = 0;
+    };
+
+    struct worker {
+        numa_thread_pool* pool;
+        ::std::size_t     node;
+        ::std::mutex      lock{};
+        opstate_base*     front{};
+        opstate_base*     back{};
+        ::std::thread     thread{};
+    };
+    struct node_state {
+        ::beman::execution::numa_node info{};
+        ::std::size_t                 first{};
+        ::std::size_t                 count{};
+        ::std::atomic<::std::size_t>  next{};
+        ::std::atomic<::std::size_t>  pending{};
+        ::std::mutex                  lock{};
+        ::std::condition_variable     condition{};
+        ::std::size_t                 idle{};
+        ::std::size_t                 wakeups{};
+    };
+
+  public:
+    struct scheduler;
+
+  private:
+    struct env {
+        numa_thread_pool* pool;
+        ::std::size_t     node;
+
+        template <typename Completion>
+        auto query(const ::beman::execution::get_completion_scheduler_t<Completion>&) const noexcept -> scheduler;
+    };
+
+    template <typename Receiver>
+    struct opstate : opstate_base {
+        using operation_state_concept = ::beman::execution::operation_state_t;
+
+        numa_thread_pool* pool;
+        ::std::size_t     node;
+        Receiver          receiver;
+
+        template <typename R>
+        opstate(numa_thread_pool* p, ::std::size_t n, R&& rcvr)
+            : pool(p), node(n), receiver(::std::forward<R>(rcvr)) {}
+        auto start() & noexcept -> void { this->pool->submit(this, this->node); }
+        auto execute() noexcept -> void override {
+            if (::beman::execution::get_stop_token(::beman::execution::get_env(this->receiver)).stop_requested())
+                ::beman::execution::set_stopped(::std::move(this->receiver));
+            else
+                ::beman::execution::set_value(::std::move(this->receiver));
+        }
+    };
+    struct sender {
+        using sender_concept = ::beman::execution::sender_t;
+        using completion_signatures =
+            ::beman::execution::completion_signatures<::beman::execution::set_value_t(),
+                                                      ::beman::execution::set_stopped_t()>;
+
+        numa_thread_pool* pool;
+        ::std::size_t     node;
+
+        auto get_env() const noexcept -> env { return {this->pool, this->node}; }
+        template <typename Receiver>
+        auto connect(Receiver&& receiver) const noexcept(::std::is_nothrow_constructible_v<::std::decay_t<Receiver>,
+                                                                                            Receiver>)
+            -> opstate<::std::decay_t<Receiver>> {
+            return {this->pool, this->node, ::std::forward<Receiver>(receiver)};
+        }
+    };
+
+  public:
+    struct scheduler {
+        using scheduler_concept = ::beman::execution::scheduler_t;
+
+        numa_thread_pool* pool;
+        //! The node work is scheduled on or `any_node`.
+        ::std::size_t     node{any_node};
+
+        auto schedule() const noexcept -> sender { return {this->pool, this->node}; }
+        auto operator==(const scheduler&) const -> bool = default;
+    };
+
+    //! The NUMA nodes with CPUs usable by the process, a single node with all CPUs if none are found.
+    static auto topology() -> ::std::vector<::beman::execution::numa_node> {
+        ::std::vector<::beman::execution::numa_node> nodes;
+#if defined(__linux__)
+        ::cpu_set_t allowed;
+        CPU_ZERO(&allowed);
+        bool              restricted{::sched_getaffinity(0, sizeof(allowed), &allowed) == 0};
+        ::std::error_code ec;
+        for (::std::filesystem::directory_iterator it("/sys/devices/system/node", ec), end; not ec && it != end;
+             it.increment(ec)) {
+            ::std::string name{it->path().filename().string()};
+            if (name.size() <= 4u || name.compare(0u, 4u, "node") != 0 ||
+                name.find_first_not_of("0123456789", 4u) != ::std::string::npos)
+                continue;
+            ::std::ifstream in(it->path() / "cpulist");
+            ::std::string   list;
+            ::std::getline(in, list);
+            ::beman::execution::numa_node node{::std::stoul(name.substr(4u)),
+                                               ::beman::execution::detail::numa_parse_cpu_list(list)};
+            if (restricted)
+                ::std::erase_if(node.cpus, [&allowed](int cpu) {
+                    return CPU_SETSIZE <= cpu || not CPU_ISSET(cpu, &allowed);
+                });
+            if (not node.cpus.empty())
+                nodes.push_back(::std::move(node));
+        }
+        ::std::ranges::sort(nodes, {}, &::beman::execution::numa_node::id);
+#endif
+        if (nodes.empty()) {
+            nodes.emplace_back();
+            for (unsigned cpu{}, count{::std::max(1u, ::std::thread::hardware_concurrency())}; cpu != count; ++cpu)
+                nodes.front().cpus.push_back(int(cpu));
+        }
+        return nodes;
+    }
+
+    explicit numa_thread_pool(pinning pin = pinning::node) : numa_thread_pool(topology(), 0u, pin) {}
+    //! Creates `threads_per_node` workers for each node; `0` means one worker per CPU of the node.
+    numa_thread_pool(::std::vector<::beman::execution::numa_node> nodes,
+                     ::std::size_t                                threads_per_node,
+                     pinning                                      pin = pinning::node)
+        : node_count_(::std::max<::std::size_t>(1u, nodes.size())), nodes_(new node_state[this->node_count_]) {
+        for (::std::size_t n{}; n != nodes.size(); ++n) {
+            this->nodes_[n].info  = ::std::move(nodes[n]);
+            this->nodes_[n].first = this->size_;
+            this->nodes_[n].count = 0u < threads_per_node
+                                        ? threads_per_node
+                                        : ::std::max<::std::size_t>(1u, this->nodes_[n].info.cpus.size());
+            this->size_ += this->nodes_[n].count;
+        }
+        if (nodes.empty()) {
+            this->nodes_[0].count = ::std::max<::std::size_t>(1u, threads_per_node);
+            this->size_           = this->nodes_[0].count;
+        }
+        this->workers_.reset(new worker[this->size_]);
+        for (::std::size_t n{}; n != this->node_count_; ++n) {
+            for (::std::size_t w{}; w != this->nodes_[n].count; ++w) {
+                worker& wk{this->workers_[this->nodes_[n].first + w]};
+                wk.pool = this;
+                wk.node = n;
+            }
+        }
+        try {
+            for (::std::size_t n{}; n != this->node_count_; ++n)
+                for (::std::size_t w{}; w != this->nodes_[n].count; ++w)
+                    this->workers_[this->nodes_[n].first + w].thread = ::std::thread(
+                        [this, n, w, pin] { this->run(this->workers_[this->nodes_[n].first + w], w, pin); });
+        } catch (...) {
+            this->shutdown();
+            throw;
+        }
+    }
+    ~numa_thread_pool() { this->shutdown(); }
+
+    auto node_count() const noexcept -> ::std::size_t { return this->node_count_; }
+    //! The number of workers.
+    auto size() const noexcept -> ::std::size_t { return this->size_; }
+    auto node(::std::size_t n) const noexcept -> const ::beman::execution::numa_node& {
+        return this->nodes_[n].info;
+    }
+
+    auto get_scheduler() noexcept -> scheduler {
+        worker* self{current()};
+        return {this, self && self->pool == this ? self->node : any_node};
+    }
+    auto get_scheduler(::std::size_t n) noexcept -> scheduler { return {this, n < this->node_count_ ? n : any_node}; }
+
+  private:
+    ::std::size_t                   node_count_;
+    ::std::unique_ptr<node_state[]> nodes_;
+    ::std::size_t                   size_{};
+    ::std::unique_ptr<worker[]>     workers_{};
+    ::std::atomic<::std::size_t>    next_node{};
+    ::std::atomic<bool>             stopping{};
+
+    static auto current() noexcept -> worker*& {
+        static thread_local worker* rc{};
+        return rc;
+    }
+
+    auto shutdown() noexcept -> void {
+        this->stopping.store(true, ::std::memory_order_release);
+        for (::std::size_t n{}; n != this->node_count_; ++n) {
+            { ::std::lock_guard guard(this->nodes_[n].lock); }
+            this->nodes_[n].condition.notify_all();
+        }
+        for (::std::size_t w{}; w != this->size_; ++w)
+            if (this->workers_[w].thread.joinable())
+                this->workers_[w].thread.join();
+    }
+
+    static auto pin_worker([[maybe_unused]] const ::beman::execution::numa_node& node,
+                           [[maybe_unused]] ::std::size_t                        index,
+                           pinning                                               pin) noexcept -> void {
+        if (pin == pinning::none || node.cpus.empty())
+            return;
+#if defined(__linux__)
+        ::cpu_set_t set;
+        CPU_ZERO(&set);
+        if (pin == pinning::cpu) {
+            if (node.cpus[index % node.cpus.size()] < CPU_SETSIZE)
+                CPU_SET(node.cpus[index % node.cpus.size()], &set);
+        } else {
+            for (int cpu : node.cpus)
+                if (cpu < CPU_SETSIZE)
+                    CPU_SET(cpu, &set);
+        }
+        if (0 < CPU_COUNT(&set))
+            (void)::sched_setaffinity(0, sizeof(set), &set);
+#endif
+    }
+
+    auto submit(opstate_base* op, ::std::size_t node) noexcept -> void {
+        worker* target{current()};
+        if (target == nullptr || target->pool != this || (node != any_node && node != target->node)) {
+            if (node == any_node)
+                node = this->next_node.fetch_add(1u, ::std::memory_order_relaxed) % this->node_count_;
+            node_state& ns{this->nodes_[node]};
+            target = &this->workers_[ns.first + ns.next.fetch_add(1u, ::std::memory_order_relaxed) % ns.count];
+        }
+        {
+            ::std::lock_guard guard(target->lock);
+            if (auto previous_back{::std::exchange(target->back, op)})
+                previous_back->next = op;
+            else
+                target->front = op;
+            this->nodes_[target->node].pending.fetch_add(1u, ::std::memory_order_release);
+        }
+        this->wake(target->node);
+    }
+    //! Wakes an idle worker of `node` or, if all of them are busy, of another node to steal the work.
+    auto wake(::std::size_t node) noexcept -> void {
+        for (::std::size_t i{}; i != this->node_count_; ++i) {
+            node_state& ns{this->nodes_[(node + i) % this->node_count_]};
+            ::std::unique_lock guard(ns.lock);
+            if (0u < ns.idle) {
+                if (i != 0u)
+                    ++ns.wakeups;
+                guard.unlock();
+                ns.condition.notify_one();
+                return;
+            }
+        }
+    }
+    auto pop(worker& w) noexcept -> opstate_base* {
+        ::std::lock_guard guard(w.lock);
+        opstate_base*     op{w.front};
+        if (op) {
+            if ((w.front = op->next) == nullptr)
+                w.back = nullptr;
+            op->next = nullptr;
+            this->nodes_[w.node].pending.fetch_sub(1u, ::std::memory_order_relaxed);
+        }
+        return op;
+    }
+    //! Takes work from the own queue, then from the own node, then from the other nodes.
+    auto take(worker& self, ::std::size_t index) noexcept -> opstate_base* {
+        if (opstate_base* op{this->pop(self)})
+            return op;
+        for (::std::size_t i{}; i != this->node_count_; ++i) {
+            node_state& ns{this->nodes_[(self.node + i) % this->node_count_]};
+            if (ns.pending.load(::std::memory_order_acquire) == 0u)
+                continue;
+            for (::std::size_t w{1u}; w <= ns.count; ++w)
+                if (opstate_base* op{this->pop(this->workers_[ns.first + (index + w) % ns.count])})
+                    return op;
+        }
+        return nullptr;
+    }
+    auto run(worker& self, ::std::size_t index, pinning pin) noexcept -> void {
+        current() = &self;
+        pin_worker(this->nodes_[self.node].info, index, pin);
+        node_state& ns{this->nodes_[self.node]};
+        while (true) {
+            if (opstate_base* op{this->take(self, index)}) {
+                op->execute();
+                continue;
+            }
+            ::std::unique_lock guard(ns.lock);
+            if (this->stopping.load(::std::memory_order_acquire))
+                break;
+            ++ns.idle;
+            ns.condition.wait(guard, [this, &ns] {
+                return this->stopping.load(::std::memory_order_acquire) || 0u < ns.wakeups ||
+                       0u < ns.pending.load(::std::memory_order_acquire);
+            });
+            --ns.idle;
+            if (0u < ns.wakeups)
+                --ns.wakeups;
+        }
+        current() = nullptr;
+    }
+};
+
+template <typename Completion>
+inline auto
+numa_thread_pool::env::query(const ::beman::execution::get_completion_scheduler_t<Completion>&) const noexcept
+    -> scheduler {
+    return {this->pool, this->node};
+}
+} // namespace beman::execution
+
+// ----------------------------------------------------------------------------
+
+#endif
@@ -8,9 +8,15 @@
 #include <beman/execution/detail/operation_state.hpp>
 #include <beman/execution/detail/set_stopped.hpp>
 #include <beman/execution/detail/env_of_t.hpp>
+#include <beman/execution/detail/frame_cache.hpp>
+#include <beman/execution/detail/get_allocator.hpp>
 #include <beman/execution/detail/get_env.hpp>
 #include <coroutine>
+#include <cstddef>
 #include <exception>
+#include <memory>
+#include <new>
+#include <type_traits>
 #include <utility>
 
 // ----------------------------------------------------------------------------
@@ -21,6 +27,77 @@ struct operation_state_task;
 
 template <typename Receiver>
 struct connect_awaitable_promise;
+
+template <typename Alloc>
+struct is_std_allocator : ::std::false_type {};
+template <typename T>
+struct is_std_allocator<::std::allocator<T>> : ::std::true_type {};
+
+/*!
+ * \brief Allocation of the coroutine frames used by `connect_awaitable()`
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ * \internal
+ *
+ * \details
+ * If the receiver's environment provides an allocator other than
+ * `std::allocator` via `get_allocator` the frame is allocated using that
+ * allocator and a copy of the allocator is stored behind the frame to
+ * release it. Otherwise the memory comes from the thread-local `frame_cache`.
+ */
+template <typename Receiver>
+struct connect_awaitable_frame {
+    using env_t = ::beman::execution::env_of_t<Receiver>;
+    struct alignas(__STDCPP_DEFAULT_NEW_ALIGNMENT__) unit {
+        ::std::byte data[__STDCPP_DEFAULT_NEW_ALIGNMENT__];
+    };
+
+    template <typename Env>
+    struct allocator_of {
+        using type = typename ::std::allocator_traits<::std::remove_cvref_t<decltype(
+            ::beman::execution::get_allocator(::std::declval<const Env&>()))>>::template rebind_alloc<unit>;
+    };
+    static constexpr bool uses_allocator{[] {
+        if constexpr (requires(const env_t& env) { ::beman::execution::get_allocator(env); })
+            return not ::beman::execution::detail::is_std_allocator<typename allocator_of<env_t>::type>::value;
+        else
+            return false;
+    }()};
+
+    template <typename Alloc>
+    static constexpr auto offset(::std::size_t size) noexcept -> ::std::size_t {
+        return (size + alignof(Alloc) - 1u) / alignof(Alloc) * alignof(Alloc);
+    }
+    template <typename Alloc>
+    static constexpr auto units(::std::size_t size) noexcept -> ::std::size_t {
+        return (offset<Alloc>(size) + sizeof(Alloc) + sizeof(unit) - 1u) / sizeof(unit);
+    }
+
+    static auto allocate(::std::size_t size, Receiver& rcvr) -> void* {
+        if constexpr (uses_allocator) {
+            using alloc_t  = typename allocator_of<env_t>::type;
+            using traits_t = ::std::allocator_traits<alloc_t>;
+            alloc_t alloc(::beman::execution::get_allocator(::beman::execution::get_env(rcvr)));
+            void*   frame{::std::to_address(traits_t::allocate(alloc, units<alloc_t>(size)))};
+            ::new (static_cast<::std::byte*>(frame) + offset<alloc_t>(size)) alloc_t(::std::move(alloc));
+            return frame;
+        } else {
+            return ::beman::execution::detail::frame_cache::allocate(size);
+        }
+    }
+    static auto deallocate(void* frame, ::std::size_t size) noexcept -> void {
+        if constexpr (uses_allocator) {
+            using alloc_t  = typename allocator_of<env_t>::type;
+            using traits_t = ::std::allocator_traits<alloc_t>;
+            alloc_t* stored{
+                ::std::launder(reinterpret_cast<alloc_t*>(static_cast<::std::byte*>(frame) + offset<alloc_t>(size)))};
+            alloc_t alloc(::std::move(*stored));
+            stored->~alloc_t();
+            traits_t::deallocate(alloc, static_cast<unit*>(frame), units<alloc_t>(size));
+        } else {
+            ::beman::execution::detail::frame_cache::deallocate(frame, size);
+        }
+    }
+};
 } // namespace beman::execution::detail
 
 // ----------------------------------------------------------------------------
@@ -29,6 +106,19 @@ template <typename Receiver>
 struct beman::execution::detail::connect_awaitable_promise
     : ::beman::execution::detail::with_await_transform<connect_awaitable_promise<Receiver>> {
     connect_awaitable_promise(auto&&, Receiver& rcvr) noexcept : receiver(rcvr) {}
+
+    //! Accepts the awaiter argument without making operator new a template: gcc's -Wmismatched-new-delete
+    //! considers a member template operator new to mismatch the (non-template) operator delete.
+    struct any_awaiter {
+        any_awaiter(auto&&) noexcept {} // NOLINT(hicpp-explicit-conversions)
+    };
+    static auto operator new(::std::size_t size, any_awaiter, Receiver& rcvr) -> void* {
+        return ::beman::execution::detail::connect_awaitable_frame<Receiver>::allocate(size, rcvr);
+    }
+    static auto operator delete(void* frame, ::std::size_t size) noexcept -> void {
+        ::beman::execution::detail::connect_awaitable_frame<Receiver>::deallocate(frame, size);
+    }
+
     auto              initial_suspend() noexcept -> ::std::suspend_always { return {}; }
     [[noreturn]] auto final_suspend() noexcept -> ::std::suspend_always { ::std::terminate(); }
     [[noreturn]] auto unhandled_exception() noexcept -> void { ::std::terminate(); }
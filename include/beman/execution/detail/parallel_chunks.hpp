@@ -0,0 +1,228 @@
+// include/beman/execution/detail/parallel_chunks.hpp               -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef INCLUDED_BEMAN_EXECUTION_DETAIL_PARALLEL_CHUNKS
+#define INCLUDED_BEMAN_EXECUTION_DETAIL_PARALLEL_CHUNKS
+
+#include <beman/execution/detail/as_except_ptr.hpp>
+#include <beman/execution/detail/completion_signatures.hpp>
+#include <beman/execution/detail/connect.hpp>
+#include <beman/execution/detail/connect_result_t.hpp>
+#include <beman/execution/detail/emplace_from.hpp>
+#include <beman/execution/detail/env_of_t.hpp>
+#include <beman/execution/detail/get_env.hpp>
+#include <beman/execution/detail/immovable.hpp>
+#include <beman/execution/detail/operation_state.hpp>
+#include <beman/execution/detail/receiver.hpp>
+#include <beman/execution/detail/schedule.hpp>
+#include <beman/execution/detail/schedule_result_t.hpp>
+#include <beman/execution/detail/scheduler.hpp>
+#include <beman/execution/detail/sender.hpp>
+#include <beman/execution/detail/set_error.hpp>
+#include <beman/execution/detail/set_stopped.hpp>
+#include <beman/execution/detail/start.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+// ----------------------------------------------------------------------------
+
+namespace beman::execution::detail {
+//! The minimum number of elements processed by one chunk of a parallel algorithm.
+inline constexpr ::std::size_t parallel_grain{1024u};
+
+//! The number of chunks per hardware thread, allowing idle workers to pick up the work of slow ones.
+inline constexpr ::std::size_t parallel_chunks_per_thread{4u};
+
+//! The number of chunks used for `size` elements: a few per hardware thread unless chunks would become too small.
+inline auto parallel_chunk_count(::std::size_t size) noexcept -> ::std::size_t {
+    ::std::size_t threads{::std::max(1u, ::std::thread::hardware_concurrency())};
+    return ::std::clamp<::std::size_t>(size / ::beman::execution::detail::parallel_grain,
+                                       1u,
+                                       threads * ::beman::execution::detail::parallel_chunks_per_thread);
+}
+
+/*!
+ * \brief Returns an iterator to the start of `range` for use by chunk kernels
+ * \internal
+ *
+ * \details
+ * Contiguous ranges are accessed via pointers so the standard algorithms
+ * used by the kernels see plain arrays and can be vectorized.
+ */
+template <::std::ranges::random_access_range Range>
+auto parallel_begin(Range& range) {
+    if constexpr (::std::ranges::contiguous_range<Range>)
+        return ::std::ranges::data(range);
+    else
+        return ::std::ranges::begin(range);
+}
+
+/*!
+ * \brief Operation state shared by the parallel algorithms
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ * \internal
+ *
+ * \details
+ * The elements `[0, algo.size())` are split into contiguous chunks and each
+ * of the `Algo::phases` phases schedules one operation per chunk on the
+ * scheduler which calls `algo.run(phase, chunk, first, last)`. Each chunk
+ * only writes state owned by that chunk, e.g., its own partial result; the
+ * only shared write is the counter of outstanding chunks. The last chunk of a
+ * phase calls `algo.finish(phase)` which combines the partial results and
+ * returns whether another phase is needed; otherwise the receiver is
+ * completed via `algo.complete()`.
+ * Each phase has its own operation state storage, so starting the next phase
+ * from within a completing chunk doesn't destroy a running operation. Errors
+ * from the chunks are converted to `std::exception_ptr`; the first error or
+ * stop stops further phases.
+ */
+template <::beman::execution::scheduler Scheduler, typename Algo, ::beman::execution::receiver Receiver>
+struct parallel_chunks_state : ::beman::execution::detail::immovable {
+    using operation_state_concept = ::beman::execution::operation_state_t;
+
+    struct chunk_receiver {
+        using receiver_concept = ::beman::execution::receiver_t;
+        parallel_chunks_state* st;
+        ::std::size_t          phase;
+        ::std::size_t          chunk;
+
+        auto set_value() && noexcept -> void {
+            try {
+                this->st->algo.run(this->phase, this->chunk, this->st->first(this->chunk), this->st->last(this->chunk));
+            } catch (...) {
+                this->st->fail(::std::current_exception());
+            }
+            this->st->arrive(this->phase);
+        }
+        template <typename Error>
+        auto set_error(Error&& error) && noexcept -> void {
+            this->st->fail(::beman::execution::detail::as_except_ptr(::std::forward<Error>(error)));
+            this->st->arrive(this->phase);
+        }
+        auto set_stopped() && noexcept -> void {
+            this->st->stopped.store(true, ::std::memory_order_relaxed);
+            this->st->arrive(this->phase);
+        }
+        auto get_env() const noexcept -> ::beman::execution::env_of_t<Receiver> {
+            return ::beman::execution::get_env(this->st->receiver);
+        }
+    };
+    using op_t = ::beman::execution::connect_result_t<::beman::execution::schedule_result_t<Scheduler&>,
+                                                      chunk_receiver>;
+
+    Scheduler                                  scheduler;
+    Algo                                       algo;
+    Receiver                                   receiver;
+    ::std::size_t                              size{};
+    ::std::size_t                              chunks{};
+    ::std::unique_ptr<::std::optional<op_t>[]> ops{};
+    ::std::atomic<::std::size_t>               outstanding{};
+    ::std::atomic<bool>                        failed{};
+    ::std::atomic<bool>                        stopped{};
+    ::std::exception_ptr                       error{};
+
+    template <typename S, typename A, typename R>
+    parallel_chunks_state(S&& s, A&& a, R&& r)
+        : scheduler(::std::forward<S>(s)), algo(::std::forward<A>(a)), receiver(::std::forward<R>(r)) {}
+
+    auto first(::std::size_t chunk) const noexcept -> ::std::size_t { return this->size * chunk / this->chunks; }
+    auto last(::std::size_t chunk) const noexcept -> ::std::size_t { return this->size * (chunk + 1u) / this->chunks; }
+
+    auto start() & noexcept -> void {
+        try {
+            this->size   = this->algo.size();
+            this->chunks = ::beman::execution::detail::parallel_chunk_count(this->size);
+            this->algo.prepare(this->chunks);
+            this->ops.reset(new ::std::optional<op_t>[Algo::phases * this->chunks]);
+        } catch (...) {
+            ::beman::execution::set_error(::std::move(this->receiver), ::std::current_exception());
+            return;
+        }
+        this->start_phase(0u);
+    }
+    auto start_phase(::std::size_t phase) noexcept -> void {
+        ::std::optional<op_t>* phase_ops{this->ops.get() + phase * this->chunks};
+        ::std::size_t          count{this->chunks};
+        try {
+            for (::std::size_t chunk{}; chunk != count; ++chunk)
+                phase_ops[chunk].emplace(::beman::execution::detail::emplace_from([this, phase, chunk] {
+                    return ::beman::execution::connect(::beman::execution::schedule(this->scheduler),
+                                                       chunk_receiver{this, phase, chunk});
+                }));
+        } catch (...) {
+            ::beman::execution::set_error(::std::move(this->receiver), ::std::current_exception());
+            return;
+        }
+        this->outstanding.store(count, ::std::memory_order_relaxed);
+        // the last start() may complete the whole operation: don't touch *this afterwards
+        for (::std::size_t chunk{}; chunk != count; ++chunk)
+            ::beman::execution::start(*phase_ops[chunk]);
+    }
+    auto fail(::std::exception_ptr ex) noexcept -> void {
+        if (not this->failed.exchange(true, ::std::memory_order_relaxed))
+            this->error = ::std::move(ex);
+    }
+    auto arrive(::std::size_t phase) noexcept -> void {
+        if (this->outstanding.fetch_sub(1u, ::std::memory_order_acq_rel) != 1u)
+            return;
+        if (this->failed.load(::std::memory_order_relaxed))
+            ::beman::execution::set_error(::std::move(this->receiver), ::std::move(this->error));
+        else if (this->stopped.load(::std::memory_order_relaxed))
+            ::beman::execution::set_stopped(::std::move(this->receiver));
+        else {
+            bool more{};
+            try {
+                more = this->algo.finish(phase) && phase + 1u < Algo::phases;
+            } catch (...) {
+                ::beman::execution::set_error(::std::move(this->receiver), ::std::current_exception());
+                return;
+            }
+            if (more)
+                this->start_phase(phase + 1u);
+            else
+                this->algo.complete(::std::move(this->receiver));
+        }
+    }
+};
+
+/*!
+ * \brief Sender returned by the parallel algorithms
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ * \internal
+ */
+template <::beman::execution::scheduler Scheduler, typename Algo>
+struct parallel_chunks_sender {
+    using sender_concept = ::beman::execution::sender_t;
+    using completion_signatures =
+        ::beman::execution::completion_signatures<typename Algo::value_signature,
+                                                  ::beman::execution::set_error_t(::std::exception_ptr),
+                                                  ::beman::execution::set_stopped_t()>;
+
+    Scheduler scheduler;
+    Algo      algo;
+
+    template <::beman::execution::receiver Receiver>
+    auto connect(Receiver&& receiver) && -> ::beman::execution::detail::
+        parallel_chunks_state<Scheduler, Algo, ::std::remove_cvref_t<Receiver>> {
+        return {::std::move(this->scheduler), ::std::move(this->algo), ::std::forward<Receiver>(receiver)};
+    }
+    template <::beman::execution::receiver Receiver>
+    auto connect(Receiver&& receiver) const& -> ::beman::execution::detail::
+        parallel_chunks_state<Scheduler, Algo, ::std::remove_cvref_t<Receiver>> {
+        return {this->scheduler, this->algo, ::std::forward<Receiver>(receiver)};
+    }
+};
+} // namespace beman::execution::detail
+
+// ----------------------------------------------------------------------------
+
+#endif
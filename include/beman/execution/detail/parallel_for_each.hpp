@@ -0,0 +1,79 @@
+// include/beman/execution/detail/parallel_for_each.hpp             -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef INCLUDED_BEMAN_EXECUTION_DETAIL_PARALLEL_FOR_EACH
+#define INCLUDED_BEMAN_EXECUTION_DETAIL_PARALLEL_FOR_EACH
+
+#include <beman/execution/detail/parallel_chunks.hpp>
+#include <beman/execution/detail/scheduler.hpp>
+#include <beman/execution/detail/set_value.hpp>
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+// ----------------------------------------------------------------------------
+
+namespace beman::execution::detail {
+template <typename Range, typename Fun>
+struct parallel_for_each_algo {
+    static constexpr ::std::size_t phases{1u};
+    using value_signature = ::beman::execution::set_value_t();
+
+    Range range;
+    Fun   fun;
+
+    auto size() -> ::std::size_t { return ::std::size_t(::std::ranges::size(this->range)); }
+    auto prepare(::std::size_t) -> void {}
+    auto run(::std::size_t, ::std::size_t, ::std::size_t first, ::std::size_t last) -> void {
+        auto begin{::beman::execution::detail::parallel_begin(this->range)};
+        ::std::for_each(begin + first, begin + last, [this](auto&& element) {
+            ::std::invoke(this->fun, ::std::forward<decltype(element)>(element));
+        });
+    }
+    auto finish(::std::size_t) -> bool { return false; }
+    template <typename Receiver>
+    auto complete(Receiver&& receiver) noexcept -> void {
+        ::beman::execution::set_value(::std::forward<Receiver>(receiver));
+    }
+};
+
+struct parallel_for_each_t {
+    template <::beman::execution::scheduler Scheduler, ::std::ranges::random_access_range Range, typename Fun>
+        requires ::std::ranges::sized_range<Range> && ::std::ranges::viewable_range<Range> &&
+                 ::std::invocable<::std::decay_t<Fun>&, ::std::ranges::range_reference_t<Range>>
+    auto operator()(Scheduler&& scheduler, Range&& range, Fun&& fun) const {
+        using algo_t = ::beman::execution::detail::parallel_for_each_algo<::std::views::all_t<Range>,
+                                                                         ::std::decay_t<Fun>>;
+        return ::beman::execution::detail::parallel_chunks_sender<::std::remove_cvref_t<Scheduler>, algo_t>{
+            ::std::forward<Scheduler>(scheduler),
+            algo_t{::std::views::all(::std::forward<Range>(range)), ::std::forward<Fun>(fun)}};
+    }
+};
+} // namespace beman::execution::detail
+
+namespace beman::execution {
+using parallel_for_each_t = ::beman::execution::detail::parallel_for_each_t;
+/*!
+ * \brief Sender factory calling a function for each element of a range in parallel
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ *
+ * \details
+ * `parallel_for_each(sch, range, fun)` splits the random-access `range` into
+ * contiguous chunks, schedules one operation per chunk on `sch`, and calls
+ * `fun(element)` for the elements of each chunk, potentially concurrently.
+ * The sender completes with `set_value()` once all chunks are done, with
+ * `set_error(std::exception_ptr)` if `fun` or scheduling failed, or with
+ * `set_stopped()` if a chunk was stopped. The range isn't copied; it needs
+ * to stay alive until the operation completes.
+ */
+inline constexpr parallel_for_each_t parallel_for_each{};
+} // namespace beman::execution
+
+// ----------------------------------------------------------------------------
+
+#endif
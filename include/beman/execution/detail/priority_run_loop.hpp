@@ -0,0 +1,218 @@
+// include/beman/execution/detail/priority_run_loop.hpp             -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef INCLUDED_BEMAN_EXECUTION_DETAIL_PRIORITY_RUN_LOOP
+#define INCLUDED_BEMAN_EXECUTION_DETAIL_PRIORITY_RUN_LOOP
+
+#include <beman/execution/detail/completion_signatures.hpp>
+#include <beman/execution/detail/get_completion_scheduler.hpp>
+#include <beman/execution/detail/get_env.hpp>
+#include <beman/execution/detail/get_priority.hpp>
+#include <beman/execution/detail/get_stop_token.hpp>
+#include <beman/execution/detail/immovable.hpp>
+#include <beman/execution/detail/operation_state.hpp>
+#include <beman/execution/detail/query_with_default.hpp>
+#include <beman/execution/detail/scheduler.hpp>
+#include <beman/execution/detail/sender.hpp>
+#include <beman/execution/detail/set_error.hpp>
+#include <beman/execution/detail/set_stopped.hpp>
+#include <beman/execution/detail/set_value.hpp>
+
+#include <array>
+#include <cstddef>
+#include <exception>
+#include <condition_variable>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+
+// ----------------------------------------------------------------------------
+
+namespace beman::execution {
+/*!
+ * \brief A run_loop dispatching work from separate priority lanes
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ *
+ * \details
+ * Work is kept in one FIFO lane per `priority` and `run()` always executes
+ * work from the highest priority non-empty lane, except that a non-empty lane
+ * which got passed over `starvation_limit` times is served next. The lane of
+ * an operation is the priority passed to `schedule(prio)` or, when using
+ * `schedule()`, the result of `get_priority` on the receiver's environment
+ * falling back to the scheduler's priority.
+ */
+class priority_run_loop {
+  private:
+    static constexpr ::std::size_t lane_count{3u};
+    struct scheduler;
+
+    struct env {
+        priority_run_loop*           loop;
+        ::beman::execution::priority prio;
+
+        template <typename Completion>
+        auto query(const ::beman::execution::get_completion_scheduler_t<Completion>&) const noexcept -> scheduler {
+            return {this->loop, this->prio};
+        }
+    };
+
+    struct opstate_base : ::beman::execution::detail::virtual_immovable {
+        opstate_base* next{};
+        virtual auto  execute() noexcept -> void = 0;
+    };
+
+    template <typename Receiver>
+    struct opstate : opstate_base {
+        using operation_state_concept = ::beman::execution::operation_state_t;
+
+        priority_run_loop*           loop;
+        Receiver                     receiver;
+        ::beman::execution::priority prio;
+
+        template <typename R>
+        opstate(priority_run_loop* l, R&& rcvr, ::beman::execution::priority p, bool fixed)
+            : loop(l),
+              receiver(::std::forward<R>(rcvr)),
+              prio(fixed ? p
+                         : ::beman::execution::detail::query_with_default(
+                               ::beman::execution::get_priority, ::beman::execution::get_env(this->receiver), p)) {
+        }
+        auto start() & noexcept -> void {
+            try {
+                this->loop->push_back(this, this->prio);
+            } catch (...) {
+                ::beman::execution::set_error(::std::move(this->receiver), ::std::current_exception());
+            }
+        }
+        auto execute() noexcept -> void override {
+            if (::beman::execution::get_stop_token(::beman::execution::get_env(this->receiver)).stop_requested())
+                ::beman::execution::set_stopped(::std::move(this->receiver));
+            else
+                ::beman::execution::set_value(::std::move(this->receiver));
+        }
+    };
+    struct sender {
+        using sender_concept = ::beman::execution::sender_t;
+        using completion_signatures =
+            ::beman::execution::completion_signatures<::beman::execution::set_value_t(),
+                                                      ::beman::execution::set_error_t(::std::exception_ptr),
+                                                      ::beman::execution::set_stopped_t()>;
+
+        priority_run_loop*           loop;
+        ::beman::execution::priority prio;
+        bool                         fixed;
+
+        auto get_env() const noexcept -> env { return {this->loop, this->prio}; }
+        template <typename Receiver>
+        auto connect(Receiver&& receiver) noexcept -> opstate<::std::decay_t<Receiver>> {
+            return {this->loop, ::std::forward<Receiver>(receiver), this->prio, this->fixed};
+        }
+    };
+    struct scheduler {
+        using scheduler_concept = ::beman::execution::scheduler_t;
+
+        priority_run_loop*           loop;
+        ::beman::execution::priority prio{::beman::execution::priority::normal};
+
+        auto schedule() noexcept -> sender { return {this->loop, this->prio, false}; }
+        auto schedule(::beman::execution::priority p) noexcept -> sender { return {this->loop, p, true}; }
+        auto operator==(const scheduler&) const -> bool = default;
+    };
+
+    struct lane {
+        opstate_base* front{};
+        opstate_base* back{};
+        ::std::size_t passed{};
+    };
+
+    enum class state : unsigned char { starting, running, finishing };
+
+    state                          current_state{state::starting};
+    ::std::mutex                   mutex{};
+    ::std::condition_variable      condition{};
+    ::std::array<lane, lane_count> lanes{};
+    ::std::size_t                  size{};
+    ::std::size_t                  limit;
+
+    auto push_back(opstate_base* item, ::beman::execution::priority prio) -> void {
+        ::std::lock_guard guard(this->mutex);
+        lane&             l{this->lanes[static_cast<::std::size_t>(prio) % lane_count]};
+        if (auto previous_back{::std::exchange(l.back, item)}) {
+            previous_back->next = item;
+        } else {
+            l.front = item;
+        }
+        if (0u == this->size++)
+            this->condition.notify_one();
+    }
+    auto select() noexcept -> lane& {
+        lane* selected{};
+        for (lane& l : this->lanes) {
+            if (l.front != nullptr && (selected == nullptr || this->limit <= l.passed)) {
+                selected = &l;
+                if (this->limit <= l.passed)
+                    break;
+            }
+        }
+        for (lane& l : this->lanes) {
+            if (&l != selected && l.front != nullptr)
+                ++l.passed;
+        }
+        selected->passed = 0u;
+        return *selected;
+    }
+    auto pop_front() -> opstate_base* {
+        ::std::unique_lock guard(this->mutex);
+        this->condition.wait(guard, [this] { return 0u < this->size || this->current_state == state::finishing; });
+        if (0u == this->size)
+            return nullptr;
+        --this->size;
+        lane& l{this->select()};
+        if (l.front == l.back)
+            l.back = nullptr;
+        return ::std::exchange(l.front, l.front->next);
+    }
+
+  public:
+    static constexpr ::std::size_t default_starvation_limit{16u};
+
+    explicit priority_run_loop(::std::size_t starvation_limit = default_starvation_limit) noexcept
+        : limit(starvation_limit < 1u ? 1u : starvation_limit) {}
+    priority_run_loop(const priority_run_loop&) = delete;
+    priority_run_loop(priority_run_loop&&)      = delete;
+    ~priority_run_loop() {
+        ::std::lock_guard guard(this->mutex);
+        if (0u < this->size || this->current_state == state::running)
+            ::std::terminate();
+    }
+    auto operator=(const priority_run_loop&) -> priority_run_loop& = delete;
+    auto operator=(priority_run_loop&&) -> priority_run_loop&      = delete;
+
+    auto get_scheduler(::beman::execution::priority prio = ::beman::execution::priority::normal) -> scheduler {
+        return {this, prio};
+    }
+
+    auto run() -> void {
+        if (::std::lock_guard guard(this->mutex);
+            this->current_state != state::finishing &&
+            state::running == ::std::exchange(this->current_state, state::running)) {
+            ::std::terminate();
+        }
+
+        while (auto* op{this->pop_front()}) {
+            op->execute();
+        }
+    }
+    auto finish() -> void {
+        {
+            ::std::lock_guard guard(this->mutex);
+            this->current_state = state::finishing;
+        }
+        this->condition.notify_one();
+    }
+};
+} // namespace beman::execution
+
+// ----------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,211 @@
+// include/beman/execution/detail/reduce.hpp                        -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef INCLUDED_BEMAN_EXECUTION_DETAIL_REDUCE
+#define INCLUDED_BEMAN_EXECUTION_DETAIL_REDUCE
+
+#include <beman/execution/detail/as_except_ptr.hpp>
+#include <beman/execution/detail/basic_sender.hpp>
+#include <beman/execution/detail/completion_signatures.hpp>
+#include <beman/execution/detail/completion_signatures_for.hpp>
+#include <beman/execution/detail/completion_signatures_of_t.hpp>
+#include <beman/execution/detail/connect.hpp>
+#include <beman/execution/detail/connect_result_t.hpp>
+#include <beman/execution/detail/default_impls.hpp>
+#include <beman/execution/detail/env_of_t.hpp>
+#include <beman/execution/detail/forward_like.hpp>
+#include <beman/execution/detail/fwd_env.hpp>
+#include <beman/execution/detail/gather_signatures.hpp>
+#include <beman/execution/detail/get_domain_early.hpp>
+#include <beman/execution/detail/get_env.hpp>
+#include <beman/execution/detail/immovable.hpp>
+#include <beman/execution/detail/impls_for.hpp>
+#include <beman/execution/detail/make_sender.hpp>
+#include <beman/execution/detail/meta_combine.hpp>
+#include <beman/execution/detail/meta_filter.hpp>
+#include <beman/execution/detail/meta_unique.hpp>
+#include <beman/execution/detail/movable_value.hpp>
+#include <beman/execution/detail/operation_state.hpp>
+#include <beman/execution/detail/product_type.hpp>
+#include <beman/execution/detail/receiver.hpp>
+#include <beman/execution/detail/sender.hpp>
+#include <beman/execution/detail/sender_adaptor.hpp>
+#include <beman/execution/detail/sender_adaptor_closure.hpp>
+#include <beman/execution/detail/sequence_sender.hpp>
+#include <beman/execution/detail/set_error.hpp>
+#include <beman/execution/detail/set_stopped.hpp>
+#include <beman/execution/detail/set_value.hpp>
+#include <beman/execution/detail/start.hpp>
+#include <beman/execution/detail/transform_sender.hpp>
+#include <concepts>
+#include <exception>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+// ----------------------------------------------------------------------------
+
+#include <beman/execution/detail/suppress_push.hpp>
+
+namespace beman::execution::detail {
+struct reduce_t : ::beman::execution::sender_adaptor_closure<reduce_t> {
+    template <::beman::execution::detail::movable_value Init, ::beman::execution::detail::movable_value Fun>
+    auto operator()(Init&& init, Fun&& fun) const {
+        return ::beman::execution::detail::sender_adaptor{*this, ::std::forward<Init>(init), ::std::forward<Fun>(fun)};
+    }
+    template <::beman::execution::sequence_sender Sender,
+              ::beman::execution::detail::movable_value Init,
+              ::beman::execution::detail::movable_value Fun>
+    auto operator()(Sender&& sender, Init&& init, Fun&& fun) const {
+        auto domain{::beman::execution::detail::get_domain_early(sender)};
+        return ::beman::execution::transform_sender(
+            domain,
+            ::beman::execution::detail::make_sender(
+                *this,
+                ::beman::execution::detail::product_type<::std::decay_t<Init>, ::std::decay_t<Fun>>{
+                    ::std::forward<Init>(init), ::std::forward<Fun>(fun)},
+                ::std::forward<Sender>(sender)));
+    }
+};
+
+template <typename Init, typename Fun>
+struct reduce_state {
+    Init                 value;
+    Fun                  fun;
+    ::std::exception_ptr error{};
+};
+
+/*!
+ * \brief Sender consuming one item of the sequence reduced by `reduce`
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ * \internal
+ *
+ * \details
+ * A value of the item is folded into the accumulated value. If folding
+ * throws or the item completes with an error, the error is recorded and the
+ * sender completes with `set_stopped()` to end the sequence.
+ */
+template <typename Item, typename State>
+struct reduce_next {
+    template <typename Receiver>
+    struct state : ::beman::execution::detail::immovable {
+        struct item_receiver {
+            using receiver_concept = ::beman::execution::receiver_t;
+            using env_t            = ::beman::execution::detail::fwd_env<::beman::execution::env_of_t<Receiver>>;
+            state* st;
+
+            template <typename... Args>
+            auto set_value(Args&&... args) && noexcept -> void {
+                try {
+                    this->st->reduced->value = ::std::invoke(
+                        this->st->reduced->fun, ::std::move(this->st->reduced->value), ::std::forward<Args>(args)...);
+                } catch (...) {
+                    this->st->reduced->error = ::std::current_exception();
+                    ::beman::execution::set_stopped(::std::move(this->st->receiver));
+                    return;
+                }
+                ::beman::execution::set_value(::std::move(this->st->receiver));
+            }
+            template <typename Error>
+            auto set_error(Error&& error) && noexcept -> void {
+                this->st->reduced->error = ::beman::execution::detail::as_except_ptr(::std::forward<Error>(error));
+                ::beman::execution::set_stopped(::std::move(this->st->receiver));
+            }
+            auto set_stopped() && noexcept -> void { ::beman::execution::set_stopped(::std::move(this->st->receiver)); }
+            auto get_env() const noexcept -> env_t { return env_t(::beman::execution::get_env(this->st->receiver)); }
+        };
+
+        using operation_state_concept = ::beman::execution::operation_state_t;
+
+        State*                                                    reduced;
+        Receiver                                                  receiver;
+        ::beman::execution::connect_result_t<Item, item_receiver> op;
+
+        template <typename R>
+        state(Item&& item, State* s, R&& rcvr)
+            : reduced(s),
+              receiver(::std::forward<R>(rcvr)),
+              op(::beman::execution::connect(::std::move(item), item_receiver{this})) {}
+        auto start() & noexcept -> void { ::beman::execution::start(this->op); }
+    };
+
+    using sender_concept = ::beman::execution::sender_t;
+    using completion_signatures =
+        ::beman::execution::completion_signatures<::beman::execution::set_value_t(),
+                                                  ::beman::execution::set_stopped_t()>;
+
+    Item   item;
+    State* reduced;
+
+    template <::beman::execution::receiver Receiver>
+    auto connect(Receiver&& receiver) && -> state<::std::remove_cvref_t<Receiver>> {
+        return {::std::move(this->item), this->reduced, ::std::forward<Receiver>(receiver)};
+    }
+};
+
+template <>
+struct impls_for<::beman::execution::detail::reduce_t> : ::beman::execution::detail::default_impls {
+    static constexpr auto get_state = []<typename Sender, typename Receiver>(Sender&& sender, Receiver&) {
+        auto&& data{sender.template get<1>()};
+        return ::beman::execution::detail::reduce_state<
+            ::std::remove_cvref_t<decltype(data.template get<0>())>,
+            ::std::remove_cvref_t<decltype(data.template get<1>())>>{
+            ::beman::execution::detail::forward_like<Sender>(data.template get<0>()),
+            ::beman::execution::detail::forward_like<Sender>(data.template get<1>())};
+    };
+    static constexpr auto next = []<typename State, typename Item>(auto, State& state, auto&, Item&& item) {
+        return ::beman::execution::detail::reduce_next<::std::remove_cvref_t<Item>, State>{::std::forward<Item>(item),
+                                                                                           &state};
+    };
+    static constexpr auto complete =
+        []<typename Tag, typename... Args>(auto, auto& state, auto& receiver, Tag, Args&&... args) noexcept -> void {
+        if constexpr (::std::same_as<Tag, ::beman::execution::set_value_t>) {
+            ::beman::execution::set_value(::std::move(receiver), ::std::move(state.value));
+        } else if constexpr (::std::same_as<Tag, ::beman::execution::set_stopped_t>) {
+            if (state.error)
+                ::beman::execution::set_error(::std::move(receiver), ::std::move(state.error));
+            else
+                ::beman::execution::set_stopped(::std::move(receiver));
+        } else {
+            Tag()(::std::move(receiver), ::std::forward<Args>(args)...);
+        }
+    };
+};
+
+template <typename Init, typename Fun, typename Sender, typename Env>
+struct completion_signatures_for_impl<
+    ::beman::execution::detail::basic_sender<::beman::execution::detail::reduce_t,
+                                             ::beman::execution::detail::product_type<Init, Fun>,
+                                             Sender>,
+    Env> {
+    using type = ::beman::execution::detail::meta::unique<::beman::execution::detail::meta::combine<
+        ::beman::execution::completion_signatures<::beman::execution::set_value_t(Init),
+                                                  ::beman::execution::set_error_t(::std::exception_ptr),
+                                                  ::beman::execution::set_stopped_t()>,
+        ::beman::execution::detail::meta::filter_tag<::beman::execution::detail::same_tag,
+                                                     ::beman::execution::set_error_t,
+                                                     ::beman::execution::completion_signatures_of_t<Sender, Env>>>>;
+};
+} // namespace beman::execution::detail
+
+#include <beman/execution/detail/suppress_pop.hpp>
+
+namespace beman::execution {
+using reduce_t = ::beman::execution::detail::reduce_t;
+/*!
+ * \brief `reduce(sequence, init, fun)` folds the values of all items of `sequence` into a single value
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ *
+ * \details
+ * The resulting sender completes with `set_value(value)` where `value` starts
+ * as `init` and is replaced by `fun(std::move(value), args...)` for the values
+ * `args...` of each item. If an item completes with an error or `fun` throws
+ * the sequence is stopped and the sender completes with `set_error()` using
+ * an `std::exception_ptr`.
+ */
+inline constexpr ::beman::execution::reduce_t reduce{};
+} // namespace beman::execution
+
+// ----------------------------------------------------------------------------
+
+#endif
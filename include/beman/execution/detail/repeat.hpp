@@ -0,0 +1,291 @@
+// include/beman/execution/detail/repeat.hpp                        -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef INCLUDED_BEMAN_EXECUTION_DETAIL_REPEAT
+#define INCLUDED_BEMAN_EXECUTION_DETAIL_REPEAT
+
+#include <beman/execution/detail/as_tuple.hpp>
+#include <beman/execution/detail/completion_signatures.hpp>
+#include <beman/execution/detail/completion_signatures_of_t.hpp>
+#include <beman/execution/detail/connect.hpp>
+#include <beman/execution/detail/connect_result_t.hpp>
+#include <beman/execution/detail/decayed_tuple.hpp>
+#include <beman/execution/detail/emplace_from.hpp>
+#include <beman/execution/detail/env_of_t.hpp>
+#include <beman/execution/detail/get_env.hpp>
+#include <beman/execution/detail/get_stop_token.hpp>
+#include <beman/execution/detail/immovable.hpp>
+#include <beman/execution/detail/meta_combine.hpp>
+#include <beman/execution/detail/meta_prepend.hpp>
+#include <beman/execution/detail/meta_to.hpp>
+#include <beman/execution/detail/meta_transform.hpp>
+#include <beman/execution/detail/meta_unique.hpp>
+#include <beman/execution/detail/operation_state.hpp>
+#include <beman/execution/detail/receiver.hpp>
+#include <beman/execution/detail/sender.hpp>
+#include <beman/execution/detail/sender_adaptor.hpp>
+#include <beman/execution/detail/sender_adaptor_closure.hpp>
+#include <beman/execution/detail/set_error.hpp>
+#include <beman/execution/detail/set_stopped.hpp>
+#include <beman/execution/detail/set_value.hpp>
+#include <beman/execution/detail/start.hpp>
+
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+// ----------------------------------------------------------------------------
+
+#include <beman/execution/detail/suppress_push.hpp>
+
+namespace beman::execution::detail {
+//! The completion signatures of a repeated sender: the values of the iterations are dropped.
+template <typename Sig>
+struct repeat_signature {
+    using type = Sig;
+};
+template <typename... A>
+struct repeat_signature<::beman::execution::set_value_t(A...)> {
+    using type = ::beman::execution::set_value_t();
+};
+template <typename Sig>
+using repeat_signature_t = typename ::beman::execution::detail::repeat_signature<Sig>::type;
+
+//! Condition of `repeat_n(sndr, n)`: done after the `n`th iteration.
+struct repeat_count {
+    ::std::size_t remaining;
+
+    template <typename... A>
+    auto operator()(A&&...) noexcept -> bool {
+        return --this->remaining == 0u;
+    }
+};
+
+/*!
+ * \brief Operation state of `repeat_effect_until(sndr, pred)` and `repeat_n(sndr, n)`
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ * \internal
+ *
+ * \details
+ * Each iteration connects the sender to a receiver referring to this state.
+ * The operation state of the iteration is kept in a `std::optional` whose
+ * storage is reused by all iterations. Iterations are started from a loop
+ * using a pending counter such that senders completing synchronously don't
+ * recurse. `done(values...)` is called with the values of each iteration
+ * and yields `true` once the repetition is complete. The final result is
+ * only recorded by the receiver and delivered by the loop once it won't
+ * touch the state anymore: the receiver may destroy the state upon
+ * completion.
+ */
+template <typename Sndr, typename Cond, typename Rcvr>
+struct repeat_state : ::beman::execution::detail::immovable {
+    using operation_state_concept = ::beman::execution::operation_state_t;
+
+    struct iteration_receiver {
+        using receiver_concept = ::beman::execution::receiver_t;
+        repeat_state* st;
+
+        template <typename... A>
+        auto set_value(A&&... a) && noexcept -> void {
+            this->st->completed(::std::forward<A>(a)...);
+        }
+        template <typename E>
+        auto set_error(E&& e) && noexcept -> void {
+            this->st->finish(::beman::execution::set_error, ::std::forward<E>(e));
+        }
+        auto set_stopped() && noexcept -> void { this->st->finish(::beman::execution::set_stopped); }
+        auto get_env() const noexcept -> ::beman::execution::env_of_t<Rcvr> {
+            return ::beman::execution::get_env(this->st->rcvr);
+        }
+    };
+    using iteration_op_t = ::beman::execution::connect_result_t<Sndr&, iteration_receiver>;
+    using result_t       = ::beman::execution::detail::meta::unique<::beman::execution::detail::meta::prepend<
+        ::std::monostate,
+        ::beman::execution::detail::meta::transform<
+            ::beman::execution::detail::as_tuple_t,
+            ::beman::execution::detail::meta::to<
+                ::std::variant,
+                ::beman::execution::detail::meta::combine<
+                    ::beman::execution::detail::meta::transform<
+                        ::beman::execution::detail::repeat_signature_t,
+                        ::beman::execution::completion_signatures_of_t<Sndr&, ::beman::execution::env_of_t<Rcvr>>>,
+                    ::beman::execution::completion_signatures<::beman::execution::set_value_t(),
+                                                              ::beman::execution::set_error_t(::std::exception_ptr),
+                                                              ::beman::execution::set_stopped_t()>>>>>>;
+
+    Sndr                            sndr;
+    Cond                            done;
+    Rcvr                            rcvr;
+    bool                            empty;
+    ::std::atomic<::std::size_t>    pending{};
+    ::std::optional<iteration_op_t> iteration{};
+    result_t                        result{};
+
+    template <typename S, typename C, typename R>
+    repeat_state(S&& s, C&& c, R&& r, bool e)
+        : sndr(::std::forward<S>(s)), done(::std::forward<C>(c)), rcvr(::std::forward<R>(r)), empty(e) {}
+
+    auto start() & noexcept -> void {
+        if (this->empty)
+            ::beman::execution::set_value(::std::move(this->rcvr));
+        else
+            this->step();
+    }
+
+    //! Starts the next iteration; only the call seeing no other pending call drives the loop.
+    auto step() noexcept -> void {
+        if (this->pending.fetch_add(1u, ::std::memory_order_acq_rel) != 0u)
+            return;
+        do {
+            if (this->result.index() != 0u) {
+                this->complete();
+                return;
+            }
+            if (::beman::execution::get_stop_token(::beman::execution::get_env(this->rcvr)).stop_requested()) {
+                ::beman::execution::set_stopped(::std::move(this->rcvr));
+                return;
+            }
+            try {
+                this->iteration.emplace(::beman::execution::detail::emplace_from(
+                    [this] { return ::beman::execution::connect(this->sndr, iteration_receiver{this}); }));
+            } catch (...) {
+                ::beman::execution::set_error(::std::move(this->rcvr), ::std::current_exception());
+                return;
+            }
+            ::beman::execution::start(*this->iteration);
+        } while (this->pending.fetch_sub(1u, ::std::memory_order_acq_rel) != 1u);
+    }
+    template <typename... A>
+    auto completed(A&&... a) noexcept -> void {
+        bool finished{};
+        try {
+            finished = ::std::invoke(this->done, ::std::forward<A>(a)...);
+        } catch (...) {
+            this->finish(::beman::execution::set_error, ::std::current_exception());
+            return;
+        }
+        if (finished)
+            this->finish(::beman::execution::set_value);
+        else
+            this->step();
+    }
+    //! Records the final result to be delivered by the loop.
+    template <typename Tag, typename... A>
+    auto finish(Tag, A&&... a) noexcept -> void {
+        try {
+            this->result.template emplace<::beman::execution::detail::decayed_tuple<Tag, A...>>(
+                Tag(), ::std::forward<A>(a)...);
+        } catch (...) {
+            this->result.template emplace<
+                ::beman::execution::detail::decayed_tuple<::beman::execution::set_error_t, ::std::exception_ptr>>(
+                ::beman::execution::set_error, ::std::current_exception());
+        }
+        this->step();
+    }
+    auto complete() noexcept -> void {
+        ::std::visit(
+            [this]<typename Tuple>(Tuple& res) noexcept -> void {
+                if constexpr (not ::std::same_as<::std::monostate, Tuple>) {
+                    ::std::apply(
+                        [this](auto tag, auto&... args) { tag(::std::move(this->rcvr), ::std::move(args)...); }, res);
+                }
+            },
+            this->result);
+    }
+};
+
+template <::beman::execution::sender Sndr, typename Cond>
+struct repeat_sender {
+    using sender_concept = ::beman::execution::sender_t;
+
+    Cond          done;
+    ::std::size_t count;
+    Sndr          sndr;
+
+    template <typename Env>
+    auto get_completion_signatures(const Env&) const noexcept {
+        return ::beman::execution::detail::meta::unique<::beman::execution::detail::meta::combine<
+            ::beman::execution::detail::meta::transform<::beman::execution::detail::repeat_signature_t,
+                                                        ::beman::execution::completion_signatures_of_t<Sndr&, Env>>,
+            ::beman::execution::completion_signatures<::beman::execution::set_value_t(),
+                                                      ::beman::execution::set_error_t(::std::exception_ptr),
+                                                      ::beman::execution::set_stopped_t()>>>();
+    }
+    template <::beman::execution::receiver Rcvr>
+    using state_t = ::beman::execution::detail::repeat_state<Sndr, Cond, ::std::remove_cvref_t<Rcvr>>;
+
+    template <::beman::execution::receiver Rcvr>
+    auto connect(Rcvr&& rcvr) && -> state_t<Rcvr> {
+        return {::std::move(this->sndr), ::std::move(this->done), ::std::forward<Rcvr>(rcvr), this->count == 0u};
+    }
+    template <::beman::execution::receiver Rcvr>
+    auto connect(Rcvr&& rcvr) const& -> state_t<Rcvr> {
+        return {this->sndr, this->done, ::std::forward<Rcvr>(rcvr), this->count == 0u};
+    }
+};
+
+struct repeat_effect_until_t : ::beman::execution::sender_adaptor_closure<repeat_effect_until_t> {
+    template <::beman::execution::sender Sndr, ::std::move_constructible Pred>
+        requires ::std::copy_constructible<::std::remove_cvref_t<Sndr>>
+    auto operator()(Sndr&& sndr, Pred&& pred) const {
+        return ::beman::execution::detail::repeat_sender<::std::remove_cvref_t<Sndr>, ::std::remove_cvref_t<Pred>>{
+            ::std::forward<Pred>(pred), 1u, ::std::forward<Sndr>(sndr)};
+    }
+    template <::std::move_constructible Pred>
+    auto operator()(Pred&& pred) const {
+        return ::beman::execution::detail::sender_adaptor{*this, ::std::forward<Pred>(pred)};
+    }
+};
+
+struct repeat_n_t : ::beman::execution::sender_adaptor_closure<repeat_n_t> {
+    template <::beman::execution::sender Sndr>
+        requires ::std::copy_constructible<::std::remove_cvref_t<Sndr>>
+    auto operator()(Sndr&& sndr, ::std::size_t n) const {
+        return ::beman::execution::detail::repeat_sender<::std::remove_cvref_t<Sndr>,
+                                                         ::beman::execution::detail::repeat_count>{
+            ::beman::execution::detail::repeat_count{n}, n, ::std::forward<Sndr>(sndr)};
+    }
+    auto operator()(::std::size_t n) const { return ::beman::execution::detail::sender_adaptor{*this, n}; }
+};
+} // namespace beman::execution::detail
+
+#include <beman/execution/detail/suppress_pop.hpp>
+
+namespace beman::execution {
+using repeat_effect_until_t = ::beman::execution::detail::repeat_effect_until_t;
+using repeat_n_t            = ::beman::execution::detail::repeat_n_t;
+/*!
+ * \brief `repeat_effect_until(sndr, pred)` runs `sndr` until `pred` returns `true`
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ *
+ * \details
+ * After each successful iteration `pred` is invoked with the values `sndr`
+ * completed with. Once it returns `true` the operation completes with
+ * `set_value()`. Errors and stop of an iteration are passed on. The
+ * receiver's stop token is checked before every iteration. All iterations
+ * reuse the same operation state storage and synchronously completing
+ * iterations are started from a loop rather than recursively.
+ */
+inline constexpr repeat_effect_until_t repeat_effect_until{};
+/*!
+ * \brief `repeat_n(sndr, n)` runs `sndr` `n` times in sequence
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ *
+ * \details
+ * Completes with `set_value()` after the `n`th successful iteration,
+ * immediately if `n` is zero. Otherwise it behaves like
+ * `repeat_effect_until()`.
+ */
+inline constexpr repeat_n_t repeat_n{};
+} // namespace beman::execution
+
+// ----------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,305 @@
+// include/beman/execution/detail/retry.hpp                         -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef INCLUDED_BEMAN_EXECUTION_DETAIL_RETRY
+#define INCLUDED_BEMAN_EXECUTION_DETAIL_RETRY
+
+#include <beman/execution/detail/as_tuple.hpp>
+#include <beman/execution/detail/completion_signatures.hpp>
+#include <beman/execution/detail/completion_signatures_of_t.hpp>
+#include <beman/execution/detail/connect.hpp>
+#include <beman/execution/detail/connect_result_t.hpp>
+#include <beman/execution/detail/decayed_tuple.hpp>
+#include <beman/execution/detail/emplace_from.hpp>
+#include <beman/execution/detail/env_of_t.hpp>
+#include <beman/execution/detail/get_env.hpp>
+#include <beman/execution/detail/get_stop_token.hpp>
+#include <beman/execution/detail/immovable.hpp>
+#include <beman/execution/detail/meta_combine.hpp>
+#include <beman/execution/detail/meta_prepend.hpp>
+#include <beman/execution/detail/meta_to.hpp>
+#include <beman/execution/detail/meta_transform.hpp>
+#include <beman/execution/detail/meta_unique.hpp>
+#include <beman/execution/detail/operation_state.hpp>
+#include <beman/execution/detail/receiver.hpp>
+#include <beman/execution/detail/sender.hpp>
+#include <beman/execution/detail/sender_adaptor.hpp>
+#include <beman/execution/detail/sender_adaptor_closure.hpp>
+#include <beman/execution/detail/set_error.hpp>
+#include <beman/execution/detail/set_stopped.hpp>
+#include <beman/execution/detail/set_value.hpp>
+#include <beman/execution/detail/start.hpp>
+#include <beman/execution/detail/timeout.hpp>
+#include <beman/execution/detail/timer_context.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+// ----------------------------------------------------------------------------
+
+#include <beman/execution/detail/suppress_push.hpp>
+
+namespace beman::execution {
+/*!
+ * \brief Retry policy for `retry()` doubling the delay between attempts
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ *
+ * \details
+ * After the `n`th failed attempt the next attempt is made after
+ * `min(initial_delay * multiplier^(n - 1), max_delay)` unless `max_attempts`
+ * attempts were made.
+ */
+struct exponential_backoff {
+    ::std::size_t                               max_attempts{3u};
+    ::beman::execution::timer_context::duration initial_delay{::std::chrono::milliseconds(10)};
+    double                                      multiplier{2.0};
+    ::beman::execution::timer_context::duration max_delay{::std::chrono::seconds(1)};
+
+    auto operator()(::std::size_t failures) const noexcept
+        -> ::std::optional<::beman::execution::timer_context::duration> {
+        if (this->max_attempts <= failures)
+            return ::std::nullopt;
+        double delay(double(this->initial_delay.count()));
+        for (::std::size_t i{1u}; i < failures && delay < double(this->max_delay.count()); ++i)
+            delay *= this->multiplier;
+        return ::std::min(
+            ::beman::execution::timer_context::duration(::beman::execution::timer_context::duration::rep(delay)),
+            this->max_delay);
+    }
+};
+} // namespace beman::execution
+
+namespace beman::execution::detail {
+template <typename Policy>
+concept retry_policy = ::std::copy_constructible<Policy> && requires(const Policy& policy, ::std::size_t failures) {
+    {
+        policy(failures)
+    } -> ::std::convertible_to<::std::optional<::beman::execution::timer_context::duration>>;
+};
+
+/*!
+ * \brief Operation state of `retry(sndr, policy)`
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ * \internal
+ *
+ * \details
+ * Each attempt connects the sender to a receiver referring to this state.
+ * The operation states of the attempt and of the delay between attempts are
+ * kept in `std::optional`s whose storage is reused by all attempts. Attempts
+ * are started from a loop using a pending counter such that senders failing
+ * synchronously without a delay don't recurse. The final result is only
+ * recorded by the receivers and delivered by the loop once it won't touch
+ * the state anymore: the receiver may destroy the state upon completion.
+ */
+template <typename Sndr, typename Policy, typename Rcvr>
+struct retry_state : ::beman::execution::detail::immovable {
+    using operation_state_concept = ::beman::execution::operation_state_t;
+
+    struct attempt_receiver {
+        using receiver_concept = ::beman::execution::receiver_t;
+        retry_state* st;
+
+        template <typename... A>
+        auto set_value(A&&... a) && noexcept -> void {
+            this->st->finish(::beman::execution::set_value, ::std::forward<A>(a)...);
+        }
+        template <typename E>
+        auto set_error(E&& e) && noexcept -> void {
+            this->st->failed(::std::forward<E>(e));
+        }
+        auto set_stopped() && noexcept -> void { this->st->finish(::beman::execution::set_stopped); }
+        auto get_env() const noexcept -> ::beman::execution::env_of_t<Rcvr> {
+            return ::beman::execution::get_env(this->st->rcvr);
+        }
+    };
+    struct delay_receiver {
+        using receiver_concept = ::beman::execution::receiver_t;
+        retry_state* st;
+
+        auto set_value() && noexcept -> void { this->st->step(); }
+        auto set_stopped() && noexcept -> void { this->st->finish(::beman::execution::set_stopped); }
+        auto get_env() const noexcept -> ::beman::execution::env_of_t<Rcvr> {
+            return ::beman::execution::get_env(this->st->rcvr);
+        }
+    };
+    using attempt_op_t = ::beman::execution::connect_result_t<Sndr&, attempt_receiver>;
+    using delay_op_t =
+        ::beman::execution::connect_result_t<::beman::execution::timer_context::sender, delay_receiver>;
+    using result_t = ::beman::execution::detail::meta::unique<::beman::execution::detail::meta::prepend<
+        ::std::monostate,
+        ::beman::execution::detail::meta::transform<
+            ::beman::execution::detail::as_tuple_t,
+            ::beman::execution::detail::meta::to<
+                ::std::variant,
+                ::beman::execution::detail::meta::combine<
+                    ::beman::execution::completion_signatures_of_t<Sndr&, ::beman::execution::env_of_t<Rcvr>>,
+                    ::beman::execution::completion_signatures<::beman::execution::set_error_t(::std::exception_ptr),
+                                                              ::beman::execution::set_stopped_t()>>>>>>;
+
+    Sndr                               sndr;
+    Policy                             policy;
+    ::beman::execution::timer_context* timer;
+    Rcvr                               rcvr;
+    ::std::size_t                      failures{};
+    ::std::atomic<::std::size_t>       pending{};
+    ::std::optional<attempt_op_t>      attempt{};
+    ::std::optional<delay_op_t>        delay{};
+    result_t                           result{};
+
+    template <typename S, typename P, typename R>
+    retry_state(S&& s, P&& p, ::beman::execution::timer_context* t, R&& r)
+        : sndr(::std::forward<S>(s)), policy(::std::forward<P>(p)), timer(t), rcvr(::std::forward<R>(r)) {}
+
+    auto start() & noexcept -> void { this->step(); }
+
+    //! Starts the next attempt; only the call seeing no other pending call drives the loop.
+    auto step() noexcept -> void {
+        if (this->pending.fetch_add(1u, ::std::memory_order_acq_rel) != 0u)
+            return;
+        do {
+            if (this->result.index() != 0u) {
+                this->complete();
+                return;
+            }
+            if (::beman::execution::get_stop_token(::beman::execution::get_env(this->rcvr)).stop_requested()) {
+                ::beman::execution::set_stopped(::std::move(this->rcvr));
+                return;
+            }
+            try {
+                this->attempt.emplace(::beman::execution::detail::emplace_from(
+                    [this] { return ::beman::execution::connect(this->sndr, attempt_receiver{this}); }));
+            } catch (...) {
+                ::beman::execution::set_error(::std::move(this->rcvr), ::std::current_exception());
+                return;
+            }
+            ::beman::execution::start(*this->attempt);
+        } while (this->pending.fetch_sub(1u, ::std::memory_order_acq_rel) != 1u);
+    }
+    template <typename E>
+    auto failed(E&& e) noexcept -> void {
+        ::std::optional<::beman::execution::timer_context::duration> wait{};
+        try {
+            wait = this->policy(++this->failures);
+        } catch (...) {
+        }
+        if (not wait) {
+            this->finish(::beman::execution::set_error, ::std::forward<E>(e));
+        } else if (*wait <= ::beman::execution::timer_context::duration()) {
+            this->step();
+        } else {
+            this->delay.emplace(::beman::execution::detail::emplace_from([this, &wait] {
+                return ::beman::execution::connect(this->timer->schedule_after(*wait), delay_receiver{this});
+            }));
+            ::beman::execution::start(*this->delay);
+        }
+    }
+    //! Records the final result to be delivered by the loop.
+    template <typename Tag, typename... A>
+    auto finish(Tag, A&&... a) noexcept -> void {
+        try {
+            this->result.template emplace<::beman::execution::detail::decayed_tuple<Tag, A...>>(
+                Tag(), ::std::forward<A>(a)...);
+        } catch (...) {
+            this->result.template emplace<
+                ::beman::execution::detail::decayed_tuple<::beman::execution::set_error_t, ::std::exception_ptr>>(
+                ::beman::execution::set_error, ::std::current_exception());
+        }
+        this->step();
+    }
+    auto complete() noexcept -> void {
+        ::std::visit(
+            [this]<typename Tuple>(Tuple& res) noexcept -> void {
+                if constexpr (not ::std::same_as<::std::monostate, Tuple>) {
+                    ::std::apply(
+                        [this](auto tag, auto&... args) { tag(::std::move(this->rcvr), ::std::move(args)...); }, res);
+                }
+            },
+            this->result);
+    }
+};
+
+template <::beman::execution::sender Sndr, typename Policy>
+struct retry_sender {
+    using sender_concept = ::beman::execution::sender_t;
+
+    ::beman::execution::timer_context* timer;
+    Policy                             policy;
+    Sndr                               sndr;
+
+    template <typename Env>
+    auto get_completion_signatures(const Env&) const noexcept {
+        return ::beman::execution::detail::meta::unique<::beman::execution::detail::meta::combine<
+            ::beman::execution::completion_signatures_of_t<Sndr&, Env>,
+            ::beman::execution::completion_signatures<::beman::execution::set_error_t(::std::exception_ptr),
+                                                      ::beman::execution::set_stopped_t()>>>();
+    }
+    template <::beman::execution::receiver Rcvr>
+    using state_t = ::beman::execution::detail::retry_state<Sndr, Policy, ::std::remove_cvref_t<Rcvr>>;
+
+    template <::beman::execution::receiver Rcvr>
+    auto connect(Rcvr&& rcvr) && -> state_t<Rcvr> {
+        return {::std::move(this->sndr), ::std::move(this->policy), this->timer, ::std::forward<Rcvr>(rcvr)};
+    }
+    template <::beman::execution::receiver Rcvr>
+    auto connect(Rcvr&& rcvr) const& -> state_t<Rcvr> {
+        return {this->sndr, this->policy, this->timer, ::std::forward<Rcvr>(rcvr)};
+    }
+};
+
+struct retry_t : ::beman::execution::sender_adaptor_closure<retry_t> {
+    template <::beman::execution::sender Sndr, ::beman::execution::detail::retry_policy Policy>
+        requires ::std::copy_constructible<::std::remove_cvref_t<Sndr>>
+    auto operator()(Sndr&& sndr, ::beman::execution::timer_context& timer, Policy&& policy) const {
+        return ::beman::execution::detail::retry_sender<::std::remove_cvref_t<Sndr>, ::std::remove_cvref_t<Policy>>{
+            &timer, ::std::forward<Policy>(policy), ::std::forward<Sndr>(sndr)};
+    }
+    template <::beman::execution::sender Sndr, ::beman::execution::detail::retry_policy Policy>
+        requires ::std::copy_constructible<::std::remove_cvref_t<Sndr>>
+    auto operator()(Sndr&& sndr, Policy&& policy) const {
+        return (*this)(::std::forward<Sndr>(sndr),
+                       ::beman::execution::detail::default_timer_context(),
+                       ::std::forward<Policy>(policy));
+    }
+    template <::beman::execution::detail::retry_policy Policy>
+    auto operator()(::beman::execution::timer_context& timer, Policy&& policy) const {
+        return ::beman::execution::detail::sender_adaptor{*this, ::std::ref(timer), ::std::forward<Policy>(policy)};
+    }
+    template <::beman::execution::detail::retry_policy Policy>
+    auto operator()(Policy&& policy) const {
+        return ::beman::execution::detail::sender_adaptor{*this, ::std::forward<Policy>(policy)};
+    }
+};
+} // namespace beman::execution::detail
+
+#include <beman/execution/detail/suppress_pop.hpp>
+
+namespace beman::execution {
+using retry_t = ::beman::execution::detail::retry_t;
+/*!
+ * \brief `retry(sndr[, timer], policy)` runs `sndr` again after it completed with an error
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ *
+ * \details
+ * After the `n`th error `policy(n)` yields the delay before the next attempt
+ * or `std::nullopt` to give up, passing the last error on. Non-zero delays
+ * are waited for using `timer.schedule_after()`, i.e., without blocking a
+ * thread; `timer` defaults to the `timer_context` shared by the process.
+ * The receiver's stop token is checked before every attempt and cancels a
+ * pending delay. All attempts reuse the same operation state storage.
+ */
+inline constexpr retry_t retry{};
+} // namespace beman::execution
+
+// ----------------------------------------------------------------------------
+
+#endif
@@ -10,14 +10,17 @@
 #include <beman/execution/detail/get_stop_token.hpp>
 #include <beman/execution/detail/immovable.hpp>
 #include <beman/execution/detail/operation_state.hpp>
+#include <beman/execution/detail/run_loop_stats.hpp>
 #include <beman/execution/detail/scheduler.hpp>
 #include <beman/execution/detail/sender.hpp>
 #include <beman/execution/detail/set_error.hpp>
 #include <beman/execution/detail/set_stopped.hpp>
 #include <beman/execution/detail/set_value.hpp>
 
+#include <chrono>
 #include <exception>
 #include <condition_variable>
+#include <cstddef>
 #include <mutex>
 #include <type_traits>
 #include <utility>
@@ -39,8 +42,9 @@ class run_loop {
     };
 
     struct opstate_base : ::beman::execution::detail::virtual_immovable {
-        opstate_base* next{};
-        virtual auto  execute() noexcept -> void = 0;
+        opstate_base*                           next{};
+        ::std::chrono::steady_clock::time_point enqueued{};
+        virtual auto                            execute() noexcept -> void = 0;
     };
 
     template <typename Receiver>
@@ -99,9 +103,14 @@ class run_loop {
     ::std::condition_variable condition{};
     opstate_base*             front{};
     opstate_base*             back{};
+    run_loop_stats*           stats{};
 
     auto push_back(opstate_base* item) -> void {
+        if (this->stats)
+            item->enqueued = ::std::chrono::steady_clock::now();
         ::std::lock_guard guard(this->mutex);
+        if (this->stats)
+            this->stats->on_enqueue();
         if (auto previous_back{::std::exchange(this->back, item)}) {
             previous_back->next = item;
         } else {
@@ -109,15 +118,43 @@ class run_loop {
             this->condition.notify_one();
         }
     }
-    auto pop_front() -> opstate_base* {
-        ::std::unique_lock guard(this->mutex);
-        this->condition.wait(guard, [this] { return this->front || this->current_state == state::finishing; });
+    auto ready() const noexcept -> bool { return this->front || this->current_state == state::finishing; }
+    auto take_front() noexcept -> opstate_base* {
         if (this->front == this->back)
             this->back = nullptr;
         return this->front ? ::std::exchange(this->front, this->front->next) : nullptr;
     }
+    auto dequeued(opstate_base* item) -> opstate_base* {
+        if (this->stats && item)
+            this->stats->on_dequeue(::std::chrono::steady_clock::now() - item->enqueued);
+        return item;
+    }
+    auto pop_front() -> opstate_base* {
+        opstate_base* item{[this] {
+            ::std::unique_lock guard(this->mutex);
+            this->condition.wait(guard, [this] { return this->ready(); });
+            return this->take_front();
+        }()};
+        return this->dequeued(item);
+    }
+    template <typename Clock, typename Duration>
+    auto pop_front_until(const ::std::chrono::time_point<Clock, Duration>& deadline) -> opstate_base* {
+        opstate_base* item{[this, &deadline] {
+            ::std::unique_lock guard(this->mutex);
+            this->condition.wait_until(guard, deadline, [this] { return this->ready(); });
+            return this->take_front();
+        }()};
+        return this->dequeued(item);
+    }
 
   public:
+    /*!
+     * \brief Create a run_loop recording queue metrics into s
+     *
+     * \details
+     * The object s needs to outlive the run_loop.
+     */
+    explicit run_loop(::beman::execution::run_loop_stats& s) noexcept : stats(&s) {}
     run_loop() noexcept       = default;
     run_loop(const run_loop&) = delete;
     run_loop(run_loop&&)      = delete;
@@ -142,6 +179,78 @@ class run_loop {
             op->execute();
         }
     }
+    /*!
+     * \brief Run the work scheduled so far without blocking
+     *
+     * \details
+     * Work scheduled while `poll()` is running is left for the next call,
+     * i.e., the time spent is bounded even if the work keeps scheduling more
+     * work. Returns the number of operations run.
+     */
+    auto poll() -> ::std::size_t {
+        opstate_base* item{[this] {
+            ::std::lock_guard guard(this->mutex);
+            this->back = nullptr;
+            return ::std::exchange(this->front, nullptr);
+        }()};
+        ::std::size_t count{};
+        for (; item; ++count)
+            this->dequeued(::std::exchange(item, item->next))->execute();
+        return count;
+    }
+    /*!
+     * \brief Block until one operation is scheduled and run it
+     *
+     * \details
+     * Returns 0 without running anything if the queue is empty after
+     * `finish()` was called and 1 otherwise.
+     */
+    auto run_one() -> ::std::size_t {
+        if (auto* op{this->pop_front()}) {
+            op->execute();
+            return 1u;
+        }
+        return 0u;
+    }
+    /*!
+     * \brief Run scheduled work, waiting for more, until `deadline` is reached
+     *
+     * \details
+     * Operations are only started before the deadline. The call also returns
+     * when the queue is empty after `finish()` was called. Returns the number
+     * of operations run.
+     */
+    template <typename Clock, typename Duration>
+    auto run_until(const ::std::chrono::time_point<Clock, Duration>& deadline) -> ::std::size_t {
+        ::std::size_t count{};
+        while (Clock::now() < deadline) {
+            auto* op{this->pop_front_until(deadline)};
+            if (op == nullptr)
+                break;
+            op->execute();
+            ++count;
+        }
+        return count;
+    }
+    //! Run scheduled work, waiting for more, for at most `duration`; see `run_until()`.
+    template <typename Rep, typename Period>
+    auto run_for(const ::std::chrono::duration<Rep, Period>& duration) -> ::std::size_t {
+        return this->run_until(::std::chrono::steady_clock::now() + duration);
+    }
+    /*!
+     * \brief Make a finished run_loop usable again
+     *
+     * \details
+     * After `restart()` the functions running work block again waiting for
+     * work until `finish()` is called. `restart()` must not be called while
+     * `run()` is executing.
+     */
+    auto restart() -> void {
+        ::std::lock_guard guard(this->mutex);
+        if (this->current_state == state::running)
+            ::std::terminate();
+        this->current_state = state::starting;
+    }
     auto finish() -> void {
         {
             ::std::lock_guard guard(this->mutex);
@@ -0,0 +1,84 @@
+// include/beman/execution/detail/run_loop_stats.hpp                -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef INCLUDED_BEMAN_EXECUTION_DETAIL_RUN_LOOP_STATS
+#define INCLUDED_BEMAN_EXECUTION_DETAIL_RUN_LOOP_STATS
+
+#include <beman/execution/detail/immovable.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+// ----------------------------------------------------------------------------
+
+namespace beman::execution {
+class run_loop_stats;
+}
+
+// ----------------------------------------------------------------------------
+
+/*!
+ * \brief Queue metrics collected by a run_loop
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ *
+ * \details
+ * An object of this type can be passed to the constructor of a `run_loop`
+ * which then records the number of enqueued and dequeued operations, the
+ * maximum queue depth, and a histogram of the time operations spent in the
+ * queue. All counters are atomic and can be read from any thread while the
+ * `run_loop` is in use. Bucket `0` of the histogram counts delays below
+ * 1ns, bucket `i` counts delays in `[2^(i-1), 2^i)` nanoseconds, and the
+ * last bucket also counts all longer delays.
+ */
+class beman::execution::run_loop_stats : ::beman::execution::detail::immovable {
+  public:
+    static constexpr ::std::size_t buckets{40u};
+    using histogram_t = ::std::array<::std::uint64_t, buckets>;
+
+    auto enqueued() const noexcept -> ::std::uint64_t { return this->enqueued_.load(::std::memory_order_relaxed); }
+    auto dequeued() const noexcept -> ::std::uint64_t { return this->dequeued_.load(::std::memory_order_relaxed); }
+    auto depth() const noexcept -> ::std::uint64_t {
+        ::std::uint64_t out{this->dequeued()};
+        ::std::uint64_t in{this->enqueued()};
+        return in < out ? 0u : in - out;
+    }
+    auto max_depth() const noexcept -> ::std::uint64_t { return this->max_depth_.load(::std::memory_order_relaxed); }
+    auto delay_histogram() const noexcept -> histogram_t {
+        histogram_t rc{};
+        for (::std::size_t i{}; i != buckets; ++i)
+            rc[i] = this->histogram[i].load(::std::memory_order_relaxed);
+        return rc;
+    }
+    static constexpr auto bucket(::std::chrono::nanoseconds delay) noexcept -> ::std::size_t {
+        auto count{static_cast<::std::uint64_t>(::std::max(delay.count(), decltype(delay.count()){}))};
+        return ::std::min(static_cast<::std::size_t>(::std::bit_width(count)), buckets - 1u);
+    }
+
+    auto on_enqueue() noexcept -> void {
+        ::std::uint64_t in{this->enqueued_.fetch_add(1u, ::std::memory_order_relaxed) + 1u};
+        ::std::uint64_t out{this->dequeued_.load(::std::memory_order_relaxed)};
+        ::std::uint64_t depth{in < out ? 0u : in - out};
+        ::std::uint64_t current{this->max_depth_.load(::std::memory_order_relaxed)};
+        while (current < depth &&
+               not this->max_depth_.compare_exchange_weak(current, depth, ::std::memory_order_relaxed)) {
+        }
+    }
+    auto on_dequeue(::std::chrono::nanoseconds delay) noexcept -> void {
+        this->dequeued_.fetch_add(1u, ::std::memory_order_relaxed);
+        this->histogram[bucket(delay)].fetch_add(1u, ::std::memory_order_relaxed);
+    }
+
+  private:
+    ::std::atomic<::std::uint64_t>                         enqueued_{};
+    ::std::atomic<::std::uint64_t>                         dequeued_{};
+    ::std::atomic<::std::uint64_t>                         max_depth_{};
+    ::std::array<::std::atomic<::std::uint64_t>, buckets> histogram{};
+};
+
+// ----------------------------------------------------------------------------
+
+#endif
@@ -10,10 +10,12 @@
 #include <beman/execution/detail/connect.hpp>
 #include <beman/execution/detail/decayed_tuple.hpp>
 #include <beman/execution/detail/default_domain.hpp>
+#include <beman/execution/detail/decayed_same_as.hpp>
 #include <beman/execution/detail/default_impls.hpp>
 #include <beman/execution/detail/env_of_t.hpp>
 #include <beman/execution/detail/error_types_of_t.hpp>
 #include <beman/execution/detail/fwd_env.hpp>
+#include <beman/execution/detail/get_completion_scheduler.hpp>
 #include <beman/execution/detail/get_domain.hpp>
 #include <beman/execution/detail/get_env.hpp>
 #include <beman/execution/detail/impls_for.hpp>
@@ -44,6 +46,24 @@
 // ----------------------------------------------------------------------------
 
 namespace beman::execution::detail {
+/*!
+ * \brief Concept for senders whose value completion scheduler has the type `Scheduler`
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ * \internal
+ *
+ * \details
+ * Only for such senders `schedule_from` compares the completion scheduler
+ * with the target scheduler to skip a hop to the scheduler the sender already
+ * completes on.
+ */
+template <typename Sender, typename Scheduler>
+concept same_value_scheduler = requires(const Sender& sender) {
+    {
+        ::beman::execution::get_completion_scheduler<::beman::execution::set_value_t>(
+            ::beman::execution::get_env(sender))
+    } -> ::beman::execution::detail::decayed_same_as<Scheduler>;
+};
+
 struct schedule_from_t {
     template <::beman::execution::scheduler Scheduler, ::beman::execution::sender Sender>
     auto operator()(Scheduler&& scheduler, Sender&& sender) const {
@@ -97,20 +117,31 @@ struct impls_for<::beman::execution::detail::schedule_from_t> : ::beman::executi
         Receiver receiver;
         Variant  async_result{};
     };
-    template <typename Receiver, typename Scheduler, typename Variant>
+    /*!
+     * \brief The operation state of `schedule_from`
+     * \details
+     * If the child's value completion scheduler has the type of the target
+     * scheduler (`Elidable`) and compares equal to it (`same_scheduler`),
+     * value completions are forwarded directly, i.e., without storing the
+     * result and without scheduling.
+     */
+    template <typename Receiver, typename Scheduler, typename Variant, bool Elidable>
     struct state_type : state_base<Receiver, Variant> {
+        static constexpr bool elidable{Elidable};
         using receiver_t = upstream_receiver<state_base<Receiver, Variant>>;
         using operation_t =
             ::beman::execution::connect_result_t<::beman::execution::schedule_result_t<Scheduler>, receiver_t>;
         operation_t op_state;
+        bool        same_scheduler;
 
         static constexpr bool nothrow() {
             return noexcept(::beman::execution::connect(::beman::execution::schedule(::std::declval<Scheduler>()),
                                                         receiver_t{nullptr}));
         }
-        explicit state_type(Scheduler& sch, Receiver& rcvr) noexcept(nothrow())
+        explicit state_type(Scheduler& sch, Receiver& rcvr, bool same) noexcept(nothrow())
             : state_base<Receiver, Variant>{rcvr},
-              op_state(::beman::execution::connect(::beman::execution::schedule(sch), receiver_t{this})) {}
+              op_state(::beman::execution::connect(::beman::execution::schedule(sch), receiver_t{this})),
+              same_scheduler(same) {}
     };
 
     static constexpr auto get_attrs{[](const auto& data, const auto& child) noexcept -> decltype(auto) {
@@ -140,10 +171,23 @@ struct impls_for<::beman::execution::detail::schedule_from_t> : ::beman::executi
                                                                  ::beman::execution::set_error_t(::std::exception_ptr),
                                                                  ::beman::execution::set_stopped_t()>>>>>>;
 
-            return state_type<Receiver, sched_t, variant_t>(sch, receiver);
+            constexpr bool elidable{
+                ::beman::execution::detail::same_value_scheduler<::beman::execution::detail::child_type<Sender>,
+                                                                 sched_t>};
+            bool           same{};
+            if constexpr (elidable)
+                same = ::beman::execution::get_completion_scheduler<::beman::execution::set_value_t>(
+                           ::beman::execution::get_env(sender.template get<2>())) == sch;
+            return state_type<Receiver, sched_t, variant_t, elidable>(sch, receiver, same);
         }};
     static constexpr auto complete{
         []<typename Tag, typename... Args>(auto, auto& state, auto& receiver, Tag, Args&&... args) noexcept -> void {
+            if constexpr (::std::remove_cvref_t<decltype(state)>::elidable && ::std::same_as<Tag, set_value_t>) {
+                if (state.same_scheduler) {
+                    Tag()(::std::move(receiver), ::std::forward<Args>(args)...);
+                    return;
+                }
+            }
             using result_t         = ::beman::execution::detail::decayed_tuple<Tag, Args...>;
             constexpr bool nothrow = ::std::is_nothrow_constructible_v<result_t, Tag, Args...>;
 
@@ -0,0 +1,35 @@
+// include/beman/execution/detail/sequence_sender.hpp               -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef INCLUDED_BEMAN_EXECUTION_DETAIL_SEQUENCE_SENDER
+#define INCLUDED_BEMAN_EXECUTION_DETAIL_SEQUENCE_SENDER
+
+#include <beman/execution/detail/sender.hpp>
+#include <concepts>
+#include <type_traits>
+
+// ----------------------------------------------------------------------------
+
+namespace beman::execution {
+/*!
+ * \brief Tag type identifying senders producing a sequence of items
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ *
+ * \details
+ * A sequence sender passes each item of the sequence as a sender to its
+ * receiver using `set_next(receiver, item)`. Once all items are consumed
+ * the sequence completes with `set_value()`. The `completion_signatures` of a
+ * sequence sender describe the completion of the whole sequence while its
+ * `item_types` describe the completions of the item senders.
+ */
+struct sequence_sender_t : ::beman::execution::sender_t {};
+
+template <typename Sender>
+concept sequence_sender =
+    ::beman::execution::sender<Sender> &&
+    ::std::derived_from<typename ::std::remove_cvref_t<Sender>::sender_concept, ::beman::execution::sequence_sender_t>;
+} // namespace beman::execution
+
+// ----------------------------------------------------------------------------
+
+#endif
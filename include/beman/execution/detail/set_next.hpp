@@ -0,0 +1,54 @@
+// include/beman/execution/detail/set_next.hpp                      -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef INCLUDED_BEMAN_EXECUTION_DETAIL_SET_NEXT
+#define INCLUDED_BEMAN_EXECUTION_DETAIL_SET_NEXT
+
+#include <beman/execution/detail/common.hpp>
+#include <utility>
+
+#include <beman/execution/detail/suppress_push.hpp>
+
+// ----------------------------------------------------------------------------
+
+namespace beman::execution {
+/*!
+ * \brief Type of the customization point object passing an item of a sequence to a receiver.
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ */
+struct set_next_t {
+    template <typename Receiver, typename Item>
+    auto operator()(Receiver&&, Item&&) const
+        -> void = BEMAN_EXECUTION_DELETE("set_next requires the receiver to be passed as non-const lvalue");
+    template <typename Receiver, typename Item>
+    auto operator()(const Receiver&, Item&&) const
+        -> void = BEMAN_EXECUTION_DELETE("set_next requires the receiver to be passed as non-const lvalue");
+    template <typename Receiver, typename Item>
+        requires requires(Receiver& receiver, Item&& item) { receiver.set_next(::std::forward<Item>(item)); }
+    auto operator()(Receiver& receiver, Item&& item) const
+        noexcept(noexcept(receiver.set_next(::std::forward<Item>(item)))) -> decltype(auto) {
+        return receiver.set_next(::std::forward<Item>(item));
+    }
+};
+/*!
+ * \var set_next
+ * \brief Customization point object passing an item of a sequence to a receiver.
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ *
+ * \details
+ * `set_next(receiver, item)` passes the sender `item` producing the next
+ * element of a sequence to `receiver` and returns a sender which needs to be
+ * started to consume the element. This sender completes with `set_value()`
+ * once the element was consumed and the sequence may produce the next
+ * element, or with `set_stopped()` if the receiver doesn't want more
+ * elements. Sequences start the sender for the next element only after the
+ * previous one completed, i.e., the consumer applies backpressure.
+ */
+inline constexpr set_next_t set_next{};
+} // namespace beman::execution
+
+// ----------------------------------------------------------------------------
+
+#include <beman/execution/detail/suppress_pop.hpp>
+
+#endif
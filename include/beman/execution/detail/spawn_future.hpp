@@ -19,6 +19,7 @@
 #include <beman/execution/detail/make_sender.hpp>
 #include <beman/execution/detail/meta_unique.hpp>
 #include <beman/execution/detail/meta_combine.hpp>
+#include <beman/execution/detail/meta_prepend.hpp>
 #include <beman/execution/detail/prop.hpp>
 #include <beman/execution/detail/queryable.hpp>
 #include <beman/execution/detail/receiver.hpp>
@@ -0,0 +1,186 @@
+// include/beman/execution/detail/strand.hpp                        -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef INCLUDED_BEMAN_EXECUTION_DETAIL_STRAND
+#define INCLUDED_BEMAN_EXECUTION_DETAIL_STRAND
+
+#include <beman/execution/detail/atomic_intrusive_stack.hpp>
+#include <beman/execution/detail/completion_signatures.hpp>
+#include <beman/execution/detail/connect.hpp>
+#include <beman/execution/detail/connect_result_t.hpp>
+#include <beman/execution/detail/emplace_from.hpp>
+#include <beman/execution/detail/get_completion_scheduler.hpp>
+#include <beman/execution/detail/get_env.hpp>
+#include <beman/execution/detail/get_stop_token.hpp>
+#include <beman/execution/detail/immovable.hpp>
+#include <beman/execution/detail/intrusive_stack.hpp>
+#include <beman/execution/detail/operation_state.hpp>
+#include <beman/execution/detail/receiver.hpp>
+#include <beman/execution/detail/schedule.hpp>
+#include <beman/execution/detail/schedule_result_t.hpp>
+#include <beman/execution/detail/scheduler.hpp>
+#include <beman/execution/detail/sender.hpp>
+#include <beman/execution/detail/set_stopped.hpp>
+#include <beman/execution/detail/set_value.hpp>
+#include <beman/execution/detail/start.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+// ----------------------------------------------------------------------------
+
+namespace beman::execution {
+template <::beman::execution::scheduler Scheduler>
+class strand;
+}
+
+// ----------------------------------------------------------------------------
+
+/*!
+ * \brief Execution context serializing the work scheduled on it onto another scheduler
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ *
+ * \details
+ * Work scheduled via the scheduler obtained from `get_scheduler()` never runs
+ * concurrently with other work scheduled on the same strand. Operations are
+ * pushed onto a lock-free intrusive stack. The operation making the strand
+ * non-idle schedules a drain on the underlying scheduler which then executes
+ * all pending work in submission order on one worker, including work submitted
+ * while draining. No lock is taken and nothing is allocated: the strand embeds
+ * the operation state scheduling the drain. At most one drain is outstanding
+ * and it doesn't touch the drain's operation state once the strand became
+ * idle, i.e., the next drain can reuse the storage. Keeping it out of the
+ * operation states of the work allows the receiver of an executed operation
+ * to destroy that operation while the drain continues. If scheduling the
+ * drain on the underlying scheduler fails the pending work is executed inline.
+ */
+template <::beman::execution::scheduler Scheduler>
+class beman::execution::strand : ::beman::execution::detail::immovable {
+  private:
+    struct node : ::beman::execution::detail::virtual_immovable {
+        node*        next{};
+        virtual auto execute() noexcept -> void = 0;
+    };
+
+    struct drain_receiver {
+        using receiver_concept = ::beman::execution::receiver_t;
+        strand* st;
+
+        auto set_value() && noexcept -> void { this->st->drain(); }
+        template <typename Error>
+        auto set_error(Error&&) && noexcept -> void {
+            this->st->drain();
+        }
+        auto set_stopped() && noexcept -> void { this->st->drain(); }
+    };
+    using drain_op_t = ::beman::execution::connect_result_t<::beman::execution::schedule_result_t<Scheduler&>,
+                                                            drain_receiver>;
+
+    class scheduler;
+
+    struct env {
+        strand* st;
+
+        template <typename Completion>
+        auto query(const ::beman::execution::get_completion_scheduler_t<Completion>&) const noexcept -> scheduler {
+            return scheduler{this->st};
+        }
+    };
+
+    template <typename Receiver>
+    struct opstate : node {
+        using operation_state_concept = ::beman::execution::operation_state_t;
+
+        strand*  st;
+        Receiver receiver;
+
+        template <typename R>
+        opstate(strand* s, R&& rcvr) : st(s), receiver(::std::forward<R>(rcvr)) {}
+        auto start() & noexcept -> void {
+            // once pushed the operation may get executed and destroyed by another thread
+            strand* s{this->st};
+            bool    idle{s->pending.fetch_add(1u, ::std::memory_order_acq_rel) == 0u};
+            s->queue.try_push(this);
+            if (idle)
+                s->schedule_drain();
+        }
+        auto execute() noexcept -> void override {
+            if (::beman::execution::get_stop_token(::beman::execution::get_env(this->receiver)).stop_requested())
+                ::beman::execution::set_stopped(::std::move(this->receiver));
+            else
+                ::beman::execution::set_value(::std::move(this->receiver));
+        }
+    };
+
+    struct sender {
+        using sender_concept = ::beman::execution::sender_t;
+        using completion_signatures =
+            ::beman::execution::completion_signatures<::beman::execution::set_value_t(),
+                                                      ::beman::execution::set_stopped_t()>;
+
+        strand* st;
+
+        auto get_env() const noexcept -> env { return {this->st}; }
+        template <typename Receiver>
+        auto connect(Receiver&& receiver) const noexcept(::std::is_nothrow_constructible_v<::std::decay_t<Receiver>,
+                                                                                            Receiver>)
+            -> opstate<::std::decay_t<Receiver>> {
+            return {this->st, ::std::forward<Receiver>(receiver)};
+        }
+    };
+
+    class scheduler {
+      public:
+        using scheduler_concept = ::beman::execution::scheduler_t;
+
+        explicit scheduler(strand* s) noexcept : st(s) {}
+        auto schedule() const noexcept -> sender { return {this->st}; }
+        auto operator==(const scheduler&) const -> bool = default;
+
+      private:
+        strand* st;
+    };
+
+    auto schedule_drain() noexcept -> void {
+        try {
+            this->drain_op.emplace(::beman::execution::detail::emplace_from{[this] {
+                return ::beman::execution::connect(::beman::execution::schedule(this->sched), drain_receiver{this});
+            }});
+        } catch (...) {
+            this->drain();
+            return;
+        }
+        ::beman::execution::start(*this->drain_op);
+    }
+    auto drain() noexcept -> void {
+        while (true) {
+            ::beman::execution::detail::intrusive_stack<&node::next> fifo{};
+            for (auto batch{this->queue.pop_all()}; node* n{batch.pop()};)
+                fifo.push(n);
+            ::std::size_t done{};
+            while (node* n{fifo.pop()}) {
+                n->execute();
+                ++done;
+            }
+            if (this->pending.fetch_sub(done, ::std::memory_order_acq_rel) == done)
+                return;
+        }
+    }
+
+    Scheduler                                                       sched;
+    ::std::atomic<::std::size_t>                                    pending{};
+    ::beman::execution::detail::atomic_intrusive_stack<&node::next> queue{};
+    ::std::optional<drain_op_t>                                     drain_op{};
+
+  public:
+    explicit strand(Scheduler s) noexcept(::std::is_nothrow_move_constructible_v<Scheduler>) : sched(::std::move(s)) {}
+
+    auto get_scheduler() noexcept -> scheduler { return scheduler{this}; }
+};
+
+// ----------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,159 @@
+// include/beman/execution/detail/thread_context.hpp                -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef INCLUDED_BEMAN_EXECUTION_DETAIL_THREAD_CONTEXT
+#define INCLUDED_BEMAN_EXECUTION_DETAIL_THREAD_CONTEXT
+
+#include <beman/execution/detail/atomic_intrusive_stack.hpp>
+#include <beman/execution/detail/completion_signatures.hpp>
+#include <beman/execution/detail/get_completion_scheduler.hpp>
+#include <beman/execution/detail/get_env.hpp>
+#include <beman/execution/detail/get_stop_token.hpp>
+#include <beman/execution/detail/immovable.hpp>
+#include <beman/execution/detail/intrusive_stack.hpp>
+#include <beman/execution/detail/operation_state.hpp>
+#include <beman/execution/detail/scheduler.hpp>
+#include <beman/execution/detail/sender.hpp>
+#include <beman/execution/detail/set_stopped.hpp>
+#include <beman/execution/detail/set_value.hpp>
+
+#include <atomic>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+// ----------------------------------------------------------------------------
+
+namespace beman::execution {
+class thread_context;
+}
+
+// ----------------------------------------------------------------------------
+
+/*!
+ * \brief Execution context running the work scheduled on it on one thread it owns
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ *
+ * \details
+ * Scheduled operations are pushed without locking onto an intrusive
+ * multi-producer stack. The worker takes all pending operations at once,
+ * reverses them to restore submission order, and runs the whole batch before
+ * looking at the queue again. Producers only notify the worker when they turn
+ * the queue from empty to non-empty, i.e., while the worker is busy
+ * submitting work costs a single compare-and-swap. The worker sleeps on an
+ * atomic wait rather than a mutex and condition variable.
+ *
+ * The destructor runs the work already scheduled and joins the worker; no
+ * work may be scheduled once destruction started.
+ */
+class beman::execution::thread_context : ::beman::execution::detail::immovable {
+  private:
+    struct node : ::beman::execution::detail::virtual_immovable {
+        node*        next{};
+        virtual auto execute() noexcept -> void = 0;
+    };
+
+    class scheduler;
+
+    struct env {
+        thread_context* context;
+
+        template <typename Completion>
+        auto query(const ::beman::execution::get_completion_scheduler_t<Completion>&) const noexcept -> scheduler {
+            return scheduler{this->context};
+        }
+    };
+
+    template <typename Receiver>
+    struct opstate : node {
+        using operation_state_concept = ::beman::execution::operation_state_t;
+
+        thread_context* context;
+        Receiver        receiver;
+
+        template <typename R>
+        opstate(thread_context* c, R&& rcvr) : context(c), receiver(::std::forward<R>(rcvr)) {}
+        auto start() & noexcept -> void { this->context->push(this); }
+        auto execute() noexcept -> void override {
+            if (::beman::execution::get_stop_token(::beman::execution::get_env(this->receiver)).stop_requested())
+                ::beman::execution::set_stopped(::std::move(this->receiver));
+            else
+                ::beman::execution::set_value(::std::move(this->receiver));
+        }
+    };
+
+    struct sender {
+        using sender_concept = ::beman::execution::sender_t;
+        using completion_signatures =
+            ::beman::execution::completion_signatures<::beman::execution::set_value_t(),
+                                                      ::beman::execution::set_stopped_t()>;
+
+        thread_context* context;
+
+        auto get_env() const noexcept -> env { return {this->context}; }
+        template <typename Receiver>
+        auto connect(Receiver&& receiver) const noexcept(::std::is_nothrow_constructible_v<::std::decay_t<Receiver>,
+                                                                                            Receiver>)
+            -> opstate<::std::decay_t<Receiver>> {
+            return {this->context, ::std::forward<Receiver>(receiver)};
+        }
+    };
+
+    class scheduler {
+      public:
+        using scheduler_concept = ::beman::execution::scheduler_t;
+
+        explicit scheduler(thread_context* c) noexcept : context(c) {}
+        auto schedule() const noexcept -> sender { return {this->context}; }
+        auto operator==(const scheduler&) const -> bool = default;
+
+      private:
+        thread_context* context;
+    };
+
+    auto push(node* n) noexcept -> void {
+        if (this->queue.try_push(n) == nullptr) {
+            this->signal.fetch_add(1u, ::std::memory_order_release);
+            this->signal.notify_one();
+        }
+    }
+    auto run() noexcept -> void {
+        while (true) {
+            unsigned int seen{this->signal.load(::std::memory_order_acquire)};
+            auto         batch{this->queue.pop_all()};
+            if (batch.empty()) {
+                if (this->stopping.load(::std::memory_order_acquire))
+                    return;
+                this->signal.wait(seen, ::std::memory_order_acquire);
+                continue;
+            }
+            ::beman::execution::detail::intrusive_stack<&node::next> fifo{};
+            while (node* n{batch.pop()})
+                fifo.push(n);
+            while (node* n{fifo.pop()})
+                n->execute();
+        }
+    }
+
+    ::beman::execution::detail::atomic_intrusive_stack<&node::next> queue{};
+    ::std::atomic<unsigned int>                                     signal{};
+    ::std::atomic<bool>                                             stopping{};
+    ::std::thread                                                   thread{[this] { this->run(); }};
+
+  public:
+    thread_context() = default;
+    ~thread_context() {
+        this->stopping.store(true, ::std::memory_order_release);
+        this->signal.fetch_add(1u, ::std::memory_order_release);
+        this->signal.notify_one();
+        this->thread.join();
+    }
+
+    auto get_scheduler() noexcept -> scheduler { return scheduler{this}; }
+    //! The id of the thread running the scheduled work.
+    auto get_id() const noexcept -> ::std::thread::id { return this->thread.get_id(); }
+};
+
+// ----------------------------------------------------------------------------
+
+#endif
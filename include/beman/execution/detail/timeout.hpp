@@ -0,0 +1,216 @@
+// include/beman/execution/detail/timeout.hpp                       -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef INCLUDED_BEMAN_EXECUTION_DETAIL_TIMEOUT
+#define INCLUDED_BEMAN_EXECUTION_DETAIL_TIMEOUT
+
+#include <beman/execution/detail/completion_signatures.hpp>
+#include <beman/execution/detail/completion_signatures_of_t.hpp>
+#include <beman/execution/detail/connect.hpp>
+#include <beman/execution/detail/connect_result_t.hpp>
+#include <beman/execution/detail/env_of_t.hpp>
+#include <beman/execution/detail/gather_signatures.hpp>
+#include <beman/execution/detail/get_env.hpp>
+#include <beman/execution/detail/inplace_stop_source.hpp>
+#include <beman/execution/detail/meta_combine.hpp>
+#include <beman/execution/detail/meta_filter.hpp>
+#include <beman/execution/detail/meta_unique.hpp>
+#include <beman/execution/detail/operation_state.hpp>
+#include <beman/execution/detail/receiver.hpp>
+#include <beman/execution/detail/sender.hpp>
+#include <beman/execution/detail/sender_adaptor.hpp>
+#include <beman/execution/detail/sender_adaptor_closure.hpp>
+#include <beman/execution/detail/set_error.hpp>
+#include <beman/execution/detail/set_stopped.hpp>
+#include <beman/execution/detail/set_value.hpp>
+#include <beman/execution/detail/start.hpp>
+#include <beman/execution/detail/stop_when.hpp>
+#include <beman/execution/detail/timer_context.hpp>
+
+#include <concepts>
+#include <functional>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+// ----------------------------------------------------------------------------
+
+#include <beman/execution/detail/suppress_push.hpp>
+
+namespace beman::execution::detail {
+//! The timer_context used by timeout(), with_deadline(), retry(), and batch when none is passed.
+inline auto default_timer_context() -> ::beman::execution::timer_context& {
+    static ::beman::execution::timer_context context{};
+    return context;
+}
+
+inline auto timeout_deadline(::beman::execution::timer_context::duration d) noexcept
+    -> ::beman::execution::timer_context::time_point {
+    return ::beman::execution::timer_context::clock::now() + d;
+}
+inline auto timeout_deadline(::beman::execution::timer_context::time_point tp) noexcept
+    -> ::beman::execution::timer_context::time_point {
+    return tp;
+}
+
+/*!
+ * \brief Sender used by `timeout()` and `with_deadline()`
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ * \internal
+ *
+ * \details
+ * The child sender is wrapped using `stop_when()` with the token of a stop
+ * source owned by the operation state. Starting the operation adds the
+ * operation state as entry to the `timer_context`, expiring requests stop on
+ * that source. The entry is cancelled when the child completes. A
+ * `set_stopped()` completion after the entry expired is turned into
+ * `set_error(std::errc::timed_out)`. `Time` is either a duration, which is
+ * measured from `start()`, or a time point.
+ */
+template <::beman::execution::sender Sndr, typename Time>
+struct timeout_sender {
+    using sender_concept = ::beman::execution::sender_t;
+
+    ::beman::execution::timer_context* timer;
+    Time                               time;
+    Sndr                               sndr;
+
+    template <::beman::execution::receiver Rcvr>
+    struct state : ::beman::execution::timer_context::entry {
+        using operation_state_concept = ::beman::execution::operation_state_t;
+        using inner_t                 = decltype(::beman::execution::detail::stop_when(
+            ::std::declval<Sndr>(), ::std::declval<::beman::execution::inplace_stop_token>()));
+
+        struct receiver {
+            using receiver_concept = ::beman::execution::receiver_t;
+            state* st;
+
+            auto get_env() const noexcept -> ::beman::execution::env_of_t<Rcvr> {
+                return ::beman::execution::get_env(this->st->rcvr);
+            }
+            template <typename... A>
+            auto set_value(A&&... a) && noexcept -> void {
+                this->st->finish(::beman::execution::set_value, ::std::forward<A>(a)...);
+            }
+            template <typename E>
+            auto set_error(E&& e) && noexcept -> void {
+                this->st->finish(::beman::execution::set_error, ::std::forward<E>(e));
+            }
+            auto set_stopped() && noexcept -> void { this->st->finish(::beman::execution::set_stopped); }
+        };
+
+        Rcvr                                                    rcvr;
+        ::beman::execution::timer_context*                      timer;
+        Time                                                    time;
+        ::beman::execution::inplace_stop_source                 source{};
+        bool                                                    timed_out{};
+        ::beman::execution::connect_result_t<inner_t, receiver> op;
+
+        template <typename S, typename R>
+        state(S&& s, ::beman::execution::timer_context* t, Time tm, R&& r)
+            : rcvr(::std::forward<R>(r)),
+              timer(t),
+              time(tm),
+              op(::beman::execution::connect(
+                  ::beman::execution::detail::stop_when(::std::forward<S>(s), this->source.get_token()),
+                  receiver{this})) {}
+
+        auto start() & noexcept -> void {
+            this->timer->add(*this, ::beman::execution::detail::timeout_deadline(this->time));
+            ::beman::execution::start(this->op);
+        }
+        auto expire() noexcept -> void override {
+            this->timed_out = true;
+            this->source.request_stop();
+        }
+        template <typename Tag, typename... A>
+        auto finish(Tag, A&&... a) noexcept -> void {
+            this->timer->cancel(*this);
+            if constexpr (::std::same_as<Tag, ::beman::execution::set_stopped_t>) {
+                if (this->timed_out) {
+                    ::beman::execution::set_error(::std::move(this->rcvr),
+                                                  ::std::make_error_code(::std::errc::timed_out));
+                    return;
+                }
+            }
+            Tag()(::std::move(this->rcvr), ::std::forward<A>(a)...);
+        }
+    };
+
+    template <typename Env>
+    auto get_completion_signatures(const Env&) const noexcept {
+        using sigs_t = ::beman::execution::completion_signatures_of_t<Sndr, Env>;
+        return ::std::conditional_t<
+            ::std::same_as<::beman::execution::completion_signatures<>,
+                           ::beman::execution::detail::meta::filter_tag<::beman::execution::detail::same_tag,
+                                                                        ::beman::execution::set_stopped_t,
+                                                                        sigs_t>>,
+            sigs_t,
+            ::beman::execution::detail::meta::unique<::beman::execution::detail::meta::combine<
+                sigs_t,
+                ::beman::execution::completion_signatures<::beman::execution::set_error_t(::std::error_code)>>>>();
+    }
+    template <::beman::execution::receiver Rcvr>
+    auto connect(Rcvr&& rcvr) && -> state<::std::remove_cvref_t<Rcvr>> {
+        return {::std::move(this->sndr), this->timer, this->time, ::std::forward<Rcvr>(rcvr)};
+    }
+    template <::beman::execution::receiver Rcvr>
+        requires ::std::copy_constructible<Sndr>
+    auto connect(Rcvr&& rcvr) const& -> state<::std::remove_cvref_t<Rcvr>> {
+        return {this->sndr, this->timer, this->time, ::std::forward<Rcvr>(rcvr)};
+    }
+};
+
+template <typename Time>
+struct timeout_adaptor_t : ::beman::execution::sender_adaptor_closure<timeout_adaptor_t<Time>> {
+    template <::beman::execution::sender Sndr>
+    auto operator()(Sndr&& sndr, ::beman::execution::timer_context& timer, Time time) const {
+        return ::beman::execution::detail::timeout_sender<::std::remove_cvref_t<Sndr>, Time>{
+            &timer, time, ::std::forward<Sndr>(sndr)};
+    }
+    template <::beman::execution::sender Sndr>
+    auto operator()(Sndr&& sndr, Time time) const {
+        return (*this)(::std::forward<Sndr>(sndr), ::beman::execution::detail::default_timer_context(), time);
+    }
+    auto operator()(::beman::execution::timer_context& timer, Time time) const {
+        return ::beman::execution::detail::sender_adaptor{*this, ::std::ref(timer), time};
+    }
+    auto operator()(Time time) const { return ::beman::execution::detail::sender_adaptor{*this, time}; }
+};
+} // namespace beman::execution::detail
+
+#include <beman/execution/detail/suppress_pop.hpp>
+
+namespace beman::execution {
+using timeout_t = ::beman::execution::detail::timeout_adaptor_t<::beman::execution::timer_context::duration>;
+using with_deadline_t =
+    ::beman::execution::detail::timeout_adaptor_t<::beman::execution::timer_context::time_point>;
+
+/*!
+ * \brief `timeout(sndr[, timer], duration)` requests stop on `sndr` if it doesn't complete within `duration`
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ *
+ * \details
+ * The duration is measured from starting the operation using `timer`, a
+ * `timer_context` which defaults to one shared by the process. If `sndr`
+ * completes with `set_stopped()` after the time expired the resulting sender
+ * completes with `set_error(std::make_error_code(std::errc::timed_out))`;
+ * other completions, including `set_stopped()` due to a stop request from
+ * the receiver, are passed through. The timer is cancelled in O(1) when
+ * `sndr` completes first.
+ */
+inline constexpr timeout_t timeout{};
+/*!
+ * \brief `with_deadline(sndr[, timer], time_point)` requests stop on `sndr` if it doesn't complete by `time_point`
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ *
+ * \details
+ * Behaves like `timeout()` except that the time is given as an absolute
+ * `timer_context::time_point`.
+ */
+inline constexpr with_deadline_t with_deadline{};
+} // namespace beman::execution
+
+// ----------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,276 @@
+// include/beman/execution/detail/timer_context.hpp                 -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef INCLUDED_BEMAN_EXECUTION_DETAIL_TIMER_CONTEXT
+#define INCLUDED_BEMAN_EXECUTION_DETAIL_TIMER_CONTEXT
+
+#include <beman/execution/detail/completion_signatures.hpp>
+#include <beman/execution/detail/env_of_t.hpp>
+#include <beman/execution/detail/get_env.hpp>
+#include <beman/execution/detail/get_stop_token.hpp>
+#include <beman/execution/detail/immovable.hpp>
+#include <beman/execution/detail/operation_state.hpp>
+#include <beman/execution/detail/receiver.hpp>
+#include <beman/execution/detail/sender.hpp>
+#include <beman/execution/detail/set_stopped.hpp>
+#include <beman/execution/detail/set_value.hpp>
+#include <beman/execution/detail/stop_callback_for_t.hpp>
+#include <beman/execution/detail/stop_token_of_t.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+// ----------------------------------------------------------------------------
+
+namespace beman::execution {
+class timer_context;
+}
+
+// ----------------------------------------------------------------------------
+
+/*!
+ * \brief Timer facility expiring intrusive timer entries on a thread owned by the context
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ *
+ * \details
+ * The timers are kept in a hashed timing wheel: the time since construction
+ * is divided into ticks of `resolution()` and a timer expiring in tick `t`
+ * is linked into the doubly linked list of slot `t % slot_count`. Adding and
+ * cancelling a timer are O(1) and don't allocate as the `entry` is provided
+ * by the user, typically as base of an operation state. The thread only wakes
+ * up for ticks whose slot isn't empty and expires the entries of that tick
+ * by calling `expire()` without holding the lock. An entry is never expired
+ * before its deadline but may be up to one tick late.
+ *
+ * `cancel(e)` returns `true` if `e` got removed before expiring. Otherwise
+ * it waits until a concurrently running `e.expire()` returned unless it is
+ * called from within `e.expire()`, i.e., once `cancel(e)` returned `e` can
+ * be destroyed. The context doesn't access an entry after its `expire()`
+ * returned, allowing `e.expire()` to add `e` again. The `timer_context`
+ * needs to outlive the entries added to it; entries still pending when the
+ * context is destroyed don't expire.
+ *
+ * `schedule_after(delay)` yields a sender completing with `set_value()` on
+ * the context's thread once `delay` passed after it got started, or with
+ * `set_stopped()` if stop is requested before.
+ */
+class beman::execution::timer_context : ::beman::execution::detail::immovable {
+  public:
+    using clock      = ::std::chrono::steady_clock;
+    using duration   = clock::duration;
+    using time_point = clock::time_point;
+
+    static constexpr ::std::size_t slot_count{256u};
+
+    class entry : ::beman::execution::detail::virtual_immovable {
+      public:
+        virtual auto expire() noexcept -> void = 0;
+
+      private:
+        friend class timer_context;
+        entry*          prev{};
+        entry*          next{};
+        ::std::uint64_t tick{};
+        bool            linked{};
+    };
+    struct sender;
+
+    explicit timer_context(duration resolution = ::std::chrono::milliseconds(1))
+        : resolution_(resolution < duration(1) ? duration(1) : resolution), thread([this] { this->run(); }) {}
+    ~timer_context() {
+        {
+            ::std::lock_guard guard(this->lock);
+            this->stopping = true;
+        }
+        this->condition.notify_one();
+        this->thread.join();
+    }
+
+    auto resolution() const noexcept -> duration { return this->resolution_; }
+    auto size() const -> ::std::size_t {
+        ::std::lock_guard guard(this->lock);
+        return this->count;
+    }
+
+    auto add(entry& e, time_point deadline) -> void {
+        ::std::uint64_t tick{this->tick_of(deadline, true)};
+        {
+            ::std::lock_guard guard(this->lock);
+            if (this->count++ == 0u)
+                this->current = ::std::max(this->current, this->tick_of(clock::now(), false));
+            e.tick = ::std::max(tick, this->current);
+            this->link(e);
+        }
+        this->condition.notify_one();
+    }
+    auto cancel(entry& e) noexcept -> bool {
+        ::std::unique_lock guard(this->lock);
+        if (this->expiring == &e && ::std::this_thread::get_id() != this->thread.get_id())
+            this->expired.wait(guard, [this, &e] { return this->expiring != &e; });
+        if (not e.linked)
+            return false;
+        this->unlink(e);
+        return true;
+    }
+    auto schedule_after(duration delay) noexcept -> sender;
+
+  private:
+    duration                         resolution_;
+    time_point                       origin{clock::now()};
+    mutable ::std::mutex             lock{};
+    ::std::condition_variable        condition{};
+    ::std::condition_variable        expired{};
+    entry*                           expiring{};
+    ::std::array<entry*, slot_count> slots{};
+    ::std::size_t                    count{};
+    ::std::uint64_t                  current{};
+    bool                             stopping{};
+    ::std::thread                    thread;
+
+    auto tick_of(time_point tp, bool round_up) const noexcept -> ::std::uint64_t {
+        if (tp <= this->origin)
+            return 0u;
+        auto d{tp - this->origin};
+        return ::std::uint64_t(d / this->resolution_) + (round_up && d % this->resolution_ != duration() ? 1u : 0u);
+    }
+    auto slot(::std::uint64_t tick) noexcept -> entry*& { return this->slots[tick % slot_count]; }
+    auto link(entry& e) noexcept -> void {
+        entry*& head{this->slot(e.tick)};
+        e.prev = nullptr;
+        e.next = ::std::exchange(head, &e);
+        if (e.next)
+            e.next->prev = &e;
+        e.linked = true;
+    }
+    auto unlink(entry& e) noexcept -> void {
+        (e.prev ? e.prev->next : this->slot(e.tick)) = e.next;
+        if (e.next)
+            e.next->prev = e.prev;
+        e.linked = false;
+        --this->count;
+    }
+    //! Returns the next entry of the current tick; needs to be called with the lock held.
+    auto due() noexcept -> entry* {
+        for (entry* e{this->slot(this->current)}; e; e = e->next)
+            if (e->tick <= this->current)
+                return e;
+        return nullptr;
+    }
+    auto run() noexcept -> void {
+        ::std::unique_lock guard(this->lock);
+        while (not this->stopping) {
+            if (this->count == 0u) {
+                this->condition.wait(guard);
+            } else if (this->current <= this->tick_of(clock::now(), false)) {
+                while (entry* e = this->due()) {
+                    this->unlink(*e);
+                    this->expiring = e;
+                    guard.unlock();
+                    e->expire();
+                    guard.lock();
+                    this->expiring = nullptr;
+                    this->expired.notify_all();
+                }
+                ++this->current;
+            } else {
+                ::std::uint64_t next{this->current};
+                while (this->slot(next) == nullptr && next - this->current < slot_count)
+                    ++next;
+                this->condition.wait_until(guard, this->origin + this->resolution_ * duration::rep(next));
+            }
+        }
+    }
+};
+
+struct beman::execution::timer_context::sender {
+    using sender_concept = ::beman::execution::sender_t;
+    using completion_signatures =
+        ::beman::execution::completion_signatures<::beman::execution::set_value_t(),
+                                                  ::beman::execution::set_stopped_t()>;
+
+    template <typename Receiver>
+    class state : ::beman::execution::timer_context::entry {
+      private:
+        using token_t = ::beman::execution::stop_token_of_t<::beman::execution::env_of_t<Receiver>>;
+        struct cb_t {
+            state* st;
+            auto   operator()() const noexcept -> void { this->st->stopped(); }
+        };
+
+        timer_context*                                                          context;
+        duration                                                                delay;
+        Receiver                                                                receiver;
+        ::std::atomic<bool>                                                     done{};
+        bool                                                                    stop{};
+        ::std::atomic<bool>                                                     handoff{};
+        ::std::optional<::beman::execution::stop_callback_for_t<token_t, cb_t>> callback{};
+
+        //! The first of expire() and stopped() determines the result which is delivered
+        //! by whichever of it and start() comes last. Calling cancel() before completing
+        //! keeps the timer thread from touching the entry once expire() returns.
+        auto expire() noexcept -> void override {
+            if (not this->done.exchange(true, ::std::memory_order_acq_rel))
+                this->arrive();
+        }
+        auto stopped() noexcept -> void {
+            if (this->done.exchange(true, ::std::memory_order_acq_rel))
+                return;
+            this->stop = true;
+            this->context->cancel(*this);
+            this->arrive();
+        }
+        auto arrive() noexcept -> void {
+            if (not this->handoff.exchange(true, ::std::memory_order_acq_rel))
+                return;
+            this->callback.reset();
+            this->context->cancel(*this);
+            if (this->stop)
+                ::beman::execution::set_stopped(::std::move(this->receiver));
+            else
+                ::beman::execution::set_value(::std::move(this->receiver));
+        }
+
+      public:
+        using operation_state_concept = ::beman::execution::operation_state_t;
+
+        template <typename R>
+        state(timer_context* c, duration d, R&& r) : context(c), delay(d), receiver(::std::forward<R>(r)) {}
+
+        auto start() & noexcept -> void {
+            auto token{::beman::execution::get_stop_token(::beman::execution::get_env(this->receiver))};
+            if (token.stop_requested()) {
+                ::beman::execution::set_stopped(::std::move(this->receiver));
+                return;
+            }
+            this->context->add(*this, clock::now() + this->delay);
+            this->callback.emplace(token, cb_t{this});
+            this->arrive();
+        }
+    };
+
+    timer_context* context;
+    duration       delay;
+
+    template <::beman::execution::receiver Receiver>
+    auto connect(Receiver&& receiver) const& -> state<::std::remove_cvref_t<Receiver>> {
+        return {this->context, this->delay, ::std::forward<Receiver>(receiver)};
+    }
+};
+
+inline auto beman::execution::timer_context::schedule_after(duration delay) noexcept -> sender {
+    return {this, delay};
+}
+
+// ----------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,149 @@
+// include/beman/execution/detail/trace.hpp                         -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef INCLUDED_BEMAN_EXECUTION_DETAIL_TRACE
+#define INCLUDED_BEMAN_EXECUTION_DETAIL_TRACE
+
+#include <beman/execution/detail/get_env.hpp>
+#include <beman/execution/detail/get_tracer.hpp>
+#include <beman/execution/detail/receiver.hpp>
+#include <beman/execution/detail/set_error.hpp>
+#include <beman/execution/detail/set_next.hpp>
+#include <beman/execution/detail/set_stopped.hpp>
+#include <beman/execution/detail/set_value.hpp>
+#include <chrono>
+#include <type_traits>
+#include <utility>
+
+// ----------------------------------------------------------------------------
+
+namespace beman::execution::detail {
+/*!
+ * \brief Concept used to determine whether operations for Receiver report trace events
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ * \internal
+ */
+template <typename Receiver>
+concept traced_receiver = requires(const Receiver& receiver) {
+    ::beman::execution::get_tracer(::beman::execution::get_env(receiver));
+};
+
+/*!
+ * \brief Report a Completion delivered by the operation op with algorithm Tag if the receiver has a tracer
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ * \internal
+ */
+template <typename Tag, typename Completion, typename Receiver>
+inline auto trace_complete(const void* op, const Receiver& receiver) noexcept -> void {
+    if constexpr (::beman::execution::detail::traced_receiver<Receiver>) {
+        ::beman::execution::get_tracer(::beman::execution::get_env(receiver))
+            .on_complete(Tag(), Completion(), op, ::std::chrono::steady_clock::now());
+    }
+}
+
+/*!
+ * \brief Receiver wrapper reporting the completion of the operation with algorithm Tag it is connected to
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ * \internal
+ *
+ * \details
+ * The identity `op` of the operation is recorded by `trace_start()` such that
+ * the start and the completion of an operation are reported with the same tag
+ * and the same identity. All other operations are forwarded to Receiver.
+ */
+template <typename Tag, typename Receiver>
+struct trace_receiver {
+    using receiver_concept = ::beman::execution::receiver_t;
+
+    Receiver    receiver;
+    const void* op{};
+
+    template <typename... Args>
+        requires requires(Receiver&& rcvr, Args&&... args) {
+            ::beman::execution::set_value(::std::move(rcvr), ::std::forward<Args>(args)...);
+        }
+    auto set_value(Args&&... args) && noexcept -> void {
+        ::beman::execution::detail::trace_complete<Tag, ::beman::execution::set_value_t>(this->op, this->receiver);
+        ::beman::execution::set_value(::std::move(this->receiver), ::std::forward<Args>(args)...);
+    }
+    template <typename Error>
+        requires requires(Receiver&& rcvr, Error&& error) {
+            ::beman::execution::set_error(::std::move(rcvr), ::std::forward<Error>(error));
+        }
+    auto set_error(Error&& error) && noexcept -> void {
+        ::beman::execution::detail::trace_complete<Tag, ::beman::execution::set_error_t>(this->op, this->receiver);
+        ::beman::execution::set_error(::std::move(this->receiver), ::std::forward<Error>(error));
+    }
+    auto set_stopped() && noexcept -> void
+        requires requires(Receiver&& rcvr) { ::beman::execution::set_stopped(::std::move(rcvr)); }
+    {
+        ::beman::execution::detail::trace_complete<Tag, ::beman::execution::set_stopped_t>(this->op, this->receiver);
+        ::beman::execution::set_stopped(::std::move(this->receiver));
+    }
+    template <typename Item>
+        requires requires(Receiver& rcvr, Item&& item) {
+            ::beman::execution::set_next(rcvr, ::std::forward<Item>(item));
+        }
+    auto set_next(Item&& item) & noexcept(noexcept(::beman::execution::set_next(this->receiver,
+                                                                                 ::std::forward<Item>(item))))
+        -> decltype(auto) {
+        return ::beman::execution::set_next(this->receiver, ::std::forward<Item>(item));
+    }
+    auto get_env() const noexcept -> decltype(auto) { return ::beman::execution::get_env(this->receiver); }
+};
+
+/*!
+ * \brief The receiver an operation with algorithm Tag holds: wrapped into a trace_receiver if it has a tracer
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ * \internal
+ */
+template <typename Tag, typename Receiver>
+using traced_receiver_t = ::std::conditional_t<::beman::execution::detail::traced_receiver<Receiver>,
+                                               ::beman::execution::detail::trace_receiver<Tag, Receiver>,
+                                               Receiver>;
+
+/*!
+ * \brief Wrap receiver into a trace_receiver for algorithm Tag if it has a tracer
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ * \internal
+ */
+template <typename Tag, typename Receiver>
+inline auto trace_receiver_for(Receiver receiver) noexcept(::std::is_nothrow_move_constructible_v<Receiver>)
+    -> ::beman::execution::detail::traced_receiver_t<Tag, Receiver> {
+    if constexpr (::beman::execution::detail::traced_receiver<Receiver>) {
+        return {::std::move(receiver)};
+    } else {
+        return receiver;
+    }
+}
+
+/*!
+ * \brief Report the start of the operation op with algorithm Tag if the receiver has a tracer
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ * \internal
+ */
+template <typename Tag, typename Receiver>
+inline auto trace_start(const void* op, const Receiver& receiver) noexcept -> void {
+    if constexpr (::beman::execution::detail::traced_receiver<Receiver>) {
+        ::beman::execution::get_tracer(::beman::execution::get_env(receiver))
+            .on_start(Tag(), op, ::std::chrono::steady_clock::now());
+    }
+}
+
+/*!
+ * \brief Report the start of the operation op and record op to report its completion with the same identity
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ * \internal
+ */
+template <typename Tag, typename Receiver>
+inline auto trace_start(const void* op, ::beman::execution::detail::trace_receiver<Tag, Receiver>& receiver) noexcept
+    -> void {
+    receiver.op = op;
+    ::beman::execution::get_tracer(::beman::execution::get_env(receiver))
+        .on_start(Tag(), op, ::std::chrono::steady_clock::now());
+}
+} // namespace beman::execution::detail
+
+// ----------------------------------------------------------------------------
+
+#endif
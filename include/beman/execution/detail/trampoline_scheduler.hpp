@@ -0,0 +1,146 @@
+// include/beman/execution/detail/trampoline_scheduler.hpp          -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef INCLUDED_BEMAN_EXECUTION_DETAIL_TRAMPOLINE_SCHEDULER
+#define INCLUDED_BEMAN_EXECUTION_DETAIL_TRAMPOLINE_SCHEDULER
+
+#include <beman/execution/detail/completion_signatures.hpp>
+#include <beman/execution/detail/get_completion_scheduler.hpp>
+#include <beman/execution/detail/get_env.hpp>
+#include <beman/execution/detail/get_stop_token.hpp>
+#include <beman/execution/detail/immovable.hpp>
+#include <beman/execution/detail/operation_state.hpp>
+#include <beman/execution/detail/scheduler.hpp>
+#include <beman/execution/detail/sender.hpp>
+#include <beman/execution/detail/set_stopped.hpp>
+#include <beman/execution/detail/set_value.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+// ----------------------------------------------------------------------------
+
+namespace beman::execution {
+/*!
+ * \brief Scheduler running work inline while bounding the recursion depth
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ *
+ * \details
+ * Starting a `schedule()` operation completes it inline as long as fewer than
+ * `max_depth` trampoline operations are nested on the current thread. Once the
+ * limit is reached the operation is queued and gets executed by the outermost
+ * trampoline operation on this thread after the current work unwound. This way
+ * loops which repeatedly schedule on the trampoline, e.g., a coroutine awaiting
+ * synchronously completing senders, keep a bounded stack.
+ */
+class trampoline_scheduler {
+  private:
+    struct opstate_base : ::beman::execution::detail::virtual_immovable {
+        opstate_base* next{};
+        virtual auto  execute() noexcept -> void = 0;
+    };
+
+    struct trampoline : ::beman::execution::detail::immovable {
+        ::std::size_t depth{1u};
+        opstate_base* front{};
+        opstate_base* back{};
+
+        static auto current() noexcept -> trampoline*& {
+            static thread_local trampoline* rc{};
+            return rc;
+        }
+        auto push_back(opstate_base* item) noexcept -> void {
+            item->next = nullptr;
+            if (auto previous_back{::std::exchange(this->back, item)})
+                previous_back->next = item;
+            else
+                this->front = item;
+        }
+        auto pop_front() noexcept -> opstate_base* {
+            if (this->front == this->back)
+                this->back = nullptr;
+            return this->front ? ::std::exchange(this->front, this->front->next) : nullptr;
+        }
+    };
+
+    static auto run(opstate_base* op, ::std::size_t max_depth) noexcept -> void {
+        trampoline*& current{trampoline::current()};
+        if (current == nullptr) {
+            trampoline t{};
+            current = &t;
+            op->execute();
+            while (auto* next{t.pop_front()}) {
+                next->execute();
+            }
+            current = nullptr;
+        } else if (current->depth < max_depth) {
+            ++current->depth;
+            op->execute();
+            --current->depth;
+        } else {
+            current->push_back(op);
+        }
+    }
+
+    struct env {
+        ::std::size_t max_depth;
+
+        template <typename Completion>
+        auto query(const ::beman::execution::get_completion_scheduler_t<Completion>&) const noexcept
+            -> trampoline_scheduler {
+            return trampoline_scheduler{this->max_depth};
+        }
+    };
+
+    template <typename Receiver>
+    struct opstate : opstate_base {
+        using operation_state_concept = ::beman::execution::operation_state_t;
+
+        ::std::size_t max_depth;
+        Receiver      receiver;
+
+        template <typename R>
+        opstate(::std::size_t m, R&& rcvr) : max_depth(m), receiver(::std::forward<R>(rcvr)) {}
+        auto start() & noexcept -> void { trampoline_scheduler::run(this, this->max_depth); }
+        auto execute() noexcept -> void override {
+            if (::beman::execution::get_stop_token(::beman::execution::get_env(this->receiver)).stop_requested())
+                ::beman::execution::set_stopped(::std::move(this->receiver));
+            else
+                ::beman::execution::set_value(::std::move(this->receiver));
+        }
+    };
+
+    struct sender {
+        using sender_concept = ::beman::execution::sender_t;
+        using completion_signatures =
+            ::beman::execution::completion_signatures<::beman::execution::set_value_t(),
+                                                      ::beman::execution::set_stopped_t()>;
+
+        ::std::size_t max_depth;
+
+        auto get_env() const noexcept -> env { return {this->max_depth}; }
+        template <typename Receiver>
+        auto connect(Receiver&& receiver) const -> opstate<::std::decay_t<Receiver>> {
+            return {this->max_depth, ::std::forward<Receiver>(receiver)};
+        }
+    };
+
+    ::std::size_t max_depth_;
+
+  public:
+    using scheduler_concept = ::beman::execution::scheduler_t;
+    static constexpr ::std::size_t default_max_depth{16u};
+
+    explicit trampoline_scheduler(::std::size_t max_depth = default_max_depth) noexcept
+        : max_depth_(max_depth < 1u ? 1u : max_depth) {}
+
+    auto max_depth() const noexcept -> ::std::size_t { return this->max_depth_; }
+    auto schedule() const noexcept -> sender { return {this->max_depth_}; }
+    auto operator==(const trampoline_scheduler&) const -> bool = default;
+};
+} // namespace beman::execution
+
+// ----------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,106 @@
+// include/beman/execution/detail/transform_each.hpp                -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef INCLUDED_BEMAN_EXECUTION_DETAIL_TRANSFORM_EACH
+#define INCLUDED_BEMAN_EXECUTION_DETAIL_TRANSFORM_EACH
+
+#include <beman/execution/detail/basic_sender.hpp>
+#include <beman/execution/detail/completion_signatures.hpp>
+#include <beman/execution/detail/completion_signatures_for.hpp>
+#include <beman/execution/detail/completion_signatures_of_t.hpp>
+#include <beman/execution/detail/default_impls.hpp>
+#include <beman/execution/detail/get_domain_early.hpp>
+#include <beman/execution/detail/impls_for.hpp>
+#include <beman/execution/detail/item_types_of_t.hpp>
+#include <beman/execution/detail/make_sender.hpp>
+#include <beman/execution/detail/meta_combine.hpp>
+#include <beman/execution/detail/meta_transform.hpp>
+#include <beman/execution/detail/meta_unique.hpp>
+#include <beman/execution/detail/movable_value.hpp>
+#include <beman/execution/detail/sender_adaptor.hpp>
+#include <beman/execution/detail/sender_adaptor_closure.hpp>
+#include <beman/execution/detail/sequence_sender.hpp>
+#include <beman/execution/detail/set_error.hpp>
+#include <beman/execution/detail/set_next.hpp>
+#include <beman/execution/detail/set_value.hpp>
+#include <beman/execution/detail/then.hpp>
+#include <beman/execution/detail/transform_sender.hpp>
+#include <exception>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+// ----------------------------------------------------------------------------
+
+#include <beman/execution/detail/suppress_push.hpp>
+
+namespace beman::execution::detail {
+struct transform_each_t : ::beman::execution::sender_adaptor_closure<transform_each_t> {
+    template <::beman::execution::detail::movable_value Fun>
+    auto operator()(Fun&& fun) const {
+        return ::beman::execution::detail::sender_adaptor{*this, ::std::forward<Fun>(fun)};
+    }
+    template <::beman::execution::sequence_sender Sender, ::beman::execution::detail::movable_value Fun>
+    auto operator()(Sender&& sender, Fun&& fun) const {
+        auto domain{::beman::execution::detail::get_domain_early(sender)};
+        return ::beman::execution::transform_sender(
+            domain,
+            ::beman::execution::detail::make_sender(*this, ::std::forward<Fun>(fun), ::std::forward<Sender>(sender)));
+    }
+};
+
+template <>
+struct basic_sender_concept<::beman::execution::detail::transform_each_t> {
+    using type = ::beman::execution::sequence_sender_t;
+};
+
+template <>
+struct impls_for<::beman::execution::detail::transform_each_t> : ::beman::execution::detail::default_impls {
+    static constexpr auto next = []<typename Receiver, typename Item>(auto, auto& fun, Receiver& receiver, Item&& item)
+        -> decltype(auto) {
+        return ::beman::execution::set_next(receiver,
+                                            ::beman::execution::then(::std::forward<Item>(item), ::std::ref(fun)));
+    };
+};
+
+template <typename Fun, typename Sender, typename Env>
+struct completion_signatures_for_impl<
+    ::beman::execution::detail::basic_sender<::beman::execution::detail::transform_each_t, Fun, Sender>,
+    Env> {
+    using type = ::beman::execution::completion_signatures_of_t<Sender, Env>;
+};
+
+template <typename Fun, typename Sender, typename Env>
+struct item_types_for_impl<
+    ::beman::execution::detail::basic_sender<::beman::execution::detail::transform_each_t, Fun, Sender>,
+    Env> {
+    using items = ::beman::execution::item_types_of_t<Sender, Env>;
+    using type  = ::beman::execution::detail::meta::unique<::beman::execution::detail::meta::combine<
+        ::beman::execution::detail::meta::transform<
+            ::beman::execution::detail::then_transform_t<Fun&, ::beman::execution::set_value_t>::template transform,
+            items>,
+        ::std::conditional_t<
+            ::beman::execution::detail::then_exception<::beman::execution::set_value_t, Fun&, items>::value,
+            ::beman::execution::completion_signatures<::beman::execution::set_error_t(::std::exception_ptr)>,
+            ::beman::execution::completion_signatures<>>>>;
+};
+} // namespace beman::execution::detail
+
+#include <beman/execution/detail/suppress_pop.hpp>
+
+namespace beman::execution {
+using transform_each_t = ::beman::execution::detail::transform_each_t;
+/*!
+ * \brief `transform_each(sequence, fun)` applies `fun` to the values of each item of `sequence`
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ *
+ * \details
+ * Each item sender `item` is passed on as `then(item, std::ref(fun))`, i.e.,
+ * transforming an item doesn't copy `fun` and costs a function call.
+ */
+inline constexpr ::beman::execution::transform_each_t transform_each{};
+} // namespace beman::execution
+
+// ----------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,105 @@
+// include/beman/execution/detail/transform_reduce.hpp              -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef INCLUDED_BEMAN_EXECUTION_DETAIL_TRANSFORM_REDUCE
+#define INCLUDED_BEMAN_EXECUTION_DETAIL_TRANSFORM_REDUCE
+
+#include <beman/execution/detail/parallel_chunks.hpp>
+#include <beman/execution/detail/scheduler.hpp>
+#include <beman/execution/detail/set_value.hpp>
+
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <numeric>
+#include <optional>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// ----------------------------------------------------------------------------
+
+namespace beman::execution::detail {
+template <typename Range, typename T, typename Reduce, typename Transform>
+struct transform_reduce_algo {
+    static constexpr ::std::size_t phases{1u};
+    using value_signature = ::beman::execution::set_value_t(T);
+
+    Range                              range;
+    T                                  init;
+    Reduce                             reduce;
+    Transform                          transform;
+    ::std::vector<::std::optional<T>> partials{};
+
+    auto size() -> ::std::size_t { return ::std::size_t(::std::ranges::size(this->range)); }
+    auto prepare(::std::size_t chunks) -> void { this->partials.resize(chunks); }
+    auto run(::std::size_t, ::std::size_t chunk, ::std::size_t first, ::std::size_t last) -> void {
+        if (first == last)
+            return;
+        auto begin{::beman::execution::detail::parallel_begin(this->range)};
+        T    head(::std::invoke(this->transform, begin[first]));
+        this->partials[chunk].emplace(::std::transform_reduce(
+            begin + first + 1, begin + last, ::std::move(head), ::std::ref(this->reduce), ::std::ref(this->transform)));
+    }
+    auto finish(::std::size_t) -> bool {
+        for (auto& partial : this->partials)
+            if (partial)
+                this->init = ::std::invoke(this->reduce, ::std::move(this->init), ::std::move(*partial));
+        return false;
+    }
+    template <typename Receiver>
+    auto complete(Receiver&& receiver) noexcept -> void {
+        ::beman::execution::set_value(::std::forward<Receiver>(receiver), ::std::move(this->init));
+    }
+};
+
+struct transform_reduce_t {
+    template <::beman::execution::scheduler Scheduler,
+              ::std::ranges::random_access_range Range,
+              typename Init,
+              typename Reduce,
+              typename Transform>
+        requires ::std::ranges::sized_range<Range> && ::std::ranges::viewable_range<Range> &&
+                 ::std::invocable<::std::decay_t<Transform>&, ::std::ranges::range_reference_t<Range>> &&
+                 ::std::convertible_to<
+                     ::std::invoke_result_t<::std::decay_t<Reduce>&, ::std::decay_t<Init>, ::std::decay_t<Init>>,
+                     ::std::decay_t<Init>>
+    auto operator()(Scheduler&& scheduler, Range&& range, Init&& init, Reduce&& reduce, Transform&& transform) const {
+        using algo_t = ::beman::execution::detail::transform_reduce_algo<::std::views::all_t<Range>,
+                                                                        ::std::decay_t<Init>,
+                                                                        ::std::decay_t<Reduce>,
+                                                                        ::std::decay_t<Transform>>;
+        return ::beman::execution::detail::parallel_chunks_sender<::std::remove_cvref_t<Scheduler>, algo_t>{
+            ::std::forward<Scheduler>(scheduler),
+            algo_t{::std::views::all(::std::forward<Range>(range)),
+                   ::std::forward<Init>(init),
+                   ::std::forward<Reduce>(reduce),
+                   ::std::forward<Transform>(transform)}};
+    }
+};
+} // namespace beman::execution::detail
+
+namespace beman::execution {
+using transform_reduce_t = ::beman::execution::detail::transform_reduce_t;
+/*!
+ * \brief Sender factory transforming and reducing the elements of a range in parallel
+ * \headerfile beman/execution/execution.hpp <beman/execution/execution.hpp>
+ *
+ * \details
+ * `transform_reduce(sch, range, init, reduce, transform)` splits the
+ * random-access `range` into contiguous chunks and reduces each chunk on
+ * `sch` into a partial result owned by that chunk using
+ * `std::transform_reduce`, i.e., the kernel is free to reorder and vectorize.
+ * Once all chunks are done, the partial results are folded into `init` in
+ * chunk order and the sender completes with `set_value(result)`. As with
+ * `std::transform_reduce`, `reduce` needs to be associative and commutative
+ * for the result to be deterministic. Errors complete with
+ * `set_error(std::exception_ptr)`, stopped chunks with `set_stopped()`.
+ */
+inline constexpr transform_reduce_t transform_reduce{};
+} // namespace beman::execution
+
+// ----------------------------------------------------------------------------
+
+#endif
@@ -17,15 +17,19 @@
 #include <beman/execution/detail/get_completion_scheduler.hpp>
 #include <beman/execution/detail/get_delegation_scheduler.hpp>
 #include <beman/execution/detail/get_completion_signatures.hpp>
+#include <beman/execution/detail/get_priority.hpp>
+#include <beman/execution/detail/get_tracer.hpp>
 #include <beman/execution/detail/operation_state.hpp>
 #include <beman/execution/detail/sender.hpp>
 #include <beman/execution/detail/sender_in.hpp>
+#include <beman/execution/detail/sequence_sender.hpp>
 #include <beman/execution/detail/scheduler.hpp>
 #include <beman/execution/detail/receiver.hpp>
 #include <beman/execution/detail/valid_completion_for.hpp>
 
 #include <beman/execution/detail/completion_signature.hpp>
 #include <beman/execution/detail/completion_signatures.hpp>
+#include <beman/execution/detail/item_types_of_t.hpp>
 #include <beman/execution/detail/valid_completion_signatures.hpp>
 #include <beman/execution/detail/movable_value.hpp>
 #include <beman/execution/detail/matching_sig.hpp>
@@ -34,28 +38,57 @@
 #include <beman/execution/detail/set_value.hpp>
 #include <beman/execution/detail/set_error.hpp>
 #include <beman/execution/detail/set_stopped.hpp>
+#include <beman/execution/detail/set_next.hpp>
 #include <beman/execution/detail/start.hpp>
 #include <beman/execution/detail/connect.hpp>
 #include <beman/execution/detail/schedule.hpp>
 
+#include <beman/execution/detail/any_scheduler.hpp>
+#include <beman/execution/detail/any_sender_of.hpp>
+#include <beman/execution/detail/async_barrier.hpp>
+#include <beman/execution/detail/async_channel.hpp>
+#include <beman/execution/detail/async_latch.hpp>
+#include <beman/execution/detail/async_manual_reset_event.hpp>
+#include <beman/execution/detail/async_mutex.hpp>
+#include <beman/execution/detail/batch.hpp>
 #include <beman/execution/detail/bulk.hpp>
 #include <beman/execution/detail/continues_on.hpp>
+#include <beman/execution/detail/counting_semaphore.hpp>
+#include <beman/execution/detail/ensure_started.hpp>
+#include <beman/execution/detail/filter_each.hpp>
+#include <beman/execution/detail/inclusive_scan.hpp>
+#include <beman/execution/detail/inline_scheduler.hpp>
 #include <beman/execution/detail/into_variant.hpp>
+#include <beman/execution/detail/iterate.hpp>
 #include <beman/execution/detail/just.hpp>
 #include <beman/execution/detail/let.hpp>
+#include <beman/execution/detail/numa_thread_pool.hpp>
 #include <beman/execution/detail/on.hpp>
+#include <beman/execution/detail/parallel_for_each.hpp>
+#include <beman/execution/detail/priority_run_loop.hpp>
 #include <beman/execution/detail/prop.hpp>
 #include <beman/execution/detail/read_env.hpp>
+#include <beman/execution/detail/reduce.hpp>
+#include <beman/execution/detail/repeat.hpp>
+#include <beman/execution/detail/retry.hpp>
 #include <beman/execution/detail/schedule_from.hpp>
 #include <beman/execution/detail/starts_on.hpp>
+#include <beman/execution/detail/strand.hpp>
 #include <beman/execution/detail/sync_wait.hpp>
 #include <beman/execution/detail/then.hpp>
+#include <beman/execution/detail/thread_context.hpp>
+#include <beman/execution/detail/timeout.hpp>
+#include <beman/execution/detail/timer_context.hpp>
+#include <beman/execution/detail/trampoline_scheduler.hpp>
+#include <beman/execution/detail/transform_each.hpp>
+#include <beman/execution/detail/transform_reduce.hpp>
 #include <beman/execution/detail/when_all.hpp>
 #include <beman/execution/detail/when_all_with_variant.hpp>
 #include <beman/execution/detail/with_awaitable_senders.hpp>
 #include <beman/execution/detail/write_env.hpp>
 
 #include <beman/execution/detail/associate.hpp>
+#include <beman/execution/detail/bounded_counting_scope.hpp>
 #include <beman/execution/detail/counting_scope.hpp>
 #include <beman/execution/detail/scope_token.hpp>
 #include <beman/execution/detail/simple_counting_scope.hpp>
@@ -0,0 +1,208 @@
+// src/beman/execution/execution.cppm                               -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Module interface `beman.execution`: importing it provides the same
+// declarations as including <beman/execution/execution.hpp>,
+// <beman/execution/stop_token.hpp>, and the `split` algorithm without
+// reparsing the headers in every translation unit. The headers are included
+// into the global module fragment and the public names are exported by
+// using-declarations. bin/check-module-exports.py verifies that the exports
+// match the names the headers declare in namespace beman::execution.
+
+module;
+
+#include <beman/execution/execution.hpp>
+#include <beman/execution/stop_token.hpp>
+#include <beman/execution/detail/split.hpp>
+
+export module beman.execution;
+
+// ----------------------------------------------------------------------------
+
+export namespace beman::execution {
+using ::beman::execution::any_scheduler;
+using ::beman::execution::any_sender_of;
+using ::beman::execution::apply_sender;
+using ::beman::execution::as_awaitable;
+using ::beman::execution::as_awaitable_t;
+using ::beman::execution::associate;
+using ::beman::execution::associate_t;
+using ::beman::execution::async_barrier;
+using ::beman::execution::async_channel;
+using ::beman::execution::async_latch;
+using ::beman::execution::async_manual_reset_event;
+using ::beman::execution::async_mutex;
+using ::beman::execution::batch;
+using ::beman::execution::bounded_counting_scope;
+using ::beman::execution::bulk;
+using ::beman::execution::bulk_t;
+using ::beman::execution::completion_signatures;
+using ::beman::execution::completion_signatures_of_t;
+using ::beman::execution::connect;
+using ::beman::execution::connect_result_t;
+using ::beman::execution::connect_t;
+using ::beman::execution::continues_on;
+using ::beman::execution::continues_on_t;
+using ::beman::execution::counting_scope;
+using ::beman::execution::counting_semaphore;
+using ::beman::execution::default_domain;
+using ::beman::execution::empty_env;
+using ::beman::execution::ensure_started;
+using ::beman::execution::ensure_started_t;
+using ::beman::execution::env_of_t;
+using ::beman::execution::error_types_of_t;
+using ::beman::execution::exponential_backoff;
+using ::beman::execution::filter_each;
+using ::beman::execution::filter_each_t;
+using ::beman::execution::forwarding_query;
+using ::beman::execution::forwarding_query_t;
+using ::beman::execution::get_allocator;
+using ::beman::execution::get_allocator_t;
+using ::beman::execution::get_completion_scheduler;
+using ::beman::execution::get_completion_scheduler_t;
+using ::beman::execution::get_completion_signatures;
+using ::beman::execution::get_completion_signatures_t;
+using ::beman::execution::get_delegation_scheduler;
+using ::beman::execution::get_delegation_scheduler_t;
+using ::beman::execution::get_domain;
+using ::beman::execution::get_domain_t;
+using ::beman::execution::get_env;
+using ::beman::execution::get_env_t;
+using ::beman::execution::get_priority;
+using ::beman::execution::get_priority_t;
+using ::beman::execution::get_scheduler;
+using ::beman::execution::get_scheduler_t;
+using ::beman::execution::get_stop_token;
+using ::beman::execution::get_stop_token_t;
+using ::beman::execution::get_tracer;
+using ::beman::execution::get_tracer_t;
+using ::beman::execution::inclusive_scan;
+using ::beman::execution::inclusive_scan_t;
+using ::beman::execution::inline_scheduler;
+using ::beman::execution::inplace_stop_callback;
+using ::beman::execution::inplace_stop_source;
+using ::beman::execution::inplace_stop_token;
+using ::beman::execution::into_variant;
+using ::beman::execution::into_variant_t;
+using ::beman::execution::item_types_of_t;
+using ::beman::execution::iterate;
+using ::beman::execution::iterate_t;
+using ::beman::execution::just;
+using ::beman::execution::just_error;
+using ::beman::execution::just_error_t;
+using ::beman::execution::just_stopped;
+using ::beman::execution::just_stopped_t;
+using ::beman::execution::just_t;
+using ::beman::execution::let_error;
+using ::beman::execution::let_error_t;
+using ::beman::execution::let_stopped;
+using ::beman::execution::let_stopped_t;
+using ::beman::execution::let_value;
+using ::beman::execution::let_value_t;
+using ::beman::execution::never_stop_token;
+using ::beman::execution::nostopstate;
+using ::beman::execution::nostopstate_t;
+using ::beman::execution::numa_node;
+using ::beman::execution::numa_thread_pool;
+using ::beman::execution::on;
+using ::beman::execution::on_t;
+using ::beman::execution::operation_state;
+using ::beman::execution::operation_state_t;
+using ::beman::execution::parallel_for_each;
+using ::beman::execution::parallel_for_each_t;
+using ::beman::execution::priority;
+using ::beman::execution::priority_run_loop;
+using ::beman::execution::prop;
+using ::beman::execution::read_env;
+using ::beman::execution::read_env_t;
+using ::beman::execution::receiver;
+using ::beman::execution::receiver_of;
+using ::beman::execution::receiver_t;
+using ::beman::execution::reduce;
+using ::beman::execution::reduce_t;
+using ::beman::execution::repeat_effect_until;
+using ::beman::execution::repeat_effect_until_t;
+using ::beman::execution::repeat_n;
+using ::beman::execution::repeat_n_t;
+using ::beman::execution::retry;
+using ::beman::execution::retry_t;
+using ::beman::execution::run_loop;
+using ::beman::execution::run_loop_stats;
+using ::beman::execution::schedule;
+using ::beman::execution::schedule_from;
+using ::beman::execution::schedule_from_t;
+using ::beman::execution::schedule_result_t;
+using ::beman::execution::schedule_t;
+using ::beman::execution::scheduler;
+using ::beman::execution::scheduler_t;
+using ::beman::execution::scope_token;
+using ::beman::execution::sender;
+using ::beman::execution::sender_adaptor_closure;
+using ::beman::execution::sender_in;
+using ::beman::execution::sender_t;
+using ::beman::execution::sends_stopped;
+using ::beman::execution::sequence_sender;
+using ::beman::execution::sequence_sender_t;
+using ::beman::execution::set_error;
+using ::beman::execution::set_error_t;
+using ::beman::execution::set_next;
+using ::beman::execution::set_next_t;
+using ::beman::execution::set_stopped;
+using ::beman::execution::set_stopped_t;
+using ::beman::execution::set_value;
+using ::beman::execution::set_value_t;
+using ::beman::execution::simple_counting_scope;
+using ::beman::execution::spawn;
+using ::beman::execution::spawn_future;
+using ::beman::execution::spawn_future_t;
+using ::beman::execution::spawn_t;
+using ::beman::execution::split;
+using ::beman::execution::split_t;
+using ::beman::execution::start;
+using ::beman::execution::start_t;
+using ::beman::execution::starts_on;
+using ::beman::execution::starts_on_t;
+using ::beman::execution::stop_callback;
+using ::beman::execution::stop_callback_for_t;
+using ::beman::execution::stop_source;
+using ::beman::execution::stop_token;
+using ::beman::execution::stop_token_of_t;
+using ::beman::execution::stoppable_token;
+using ::beman::execution::strand;
+using ::beman::execution::sync_wait;
+using ::beman::execution::sync_wait_t;
+using ::beman::execution::tag_of_t;
+using ::beman::execution::then;
+using ::beman::execution::then_t;
+using ::beman::execution::thread_context;
+using ::beman::execution::timeout;
+using ::beman::execution::timeout_t;
+using ::beman::execution::timer_context;
+using ::beman::execution::trampoline_scheduler;
+using ::beman::execution::transform_each;
+using ::beman::execution::transform_each_t;
+using ::beman::execution::transform_reduce;
+using ::beman::execution::transform_reduce_t;
+using ::beman::execution::transform_sender;
+using ::beman::execution::unstoppable_token;
+using ::beman::execution::upon_error;
+using ::beman::execution::upon_error_t;
+using ::beman::execution::upon_stopped;
+using ::beman::execution::upon_stopped_t;
+using ::beman::execution::value_types_of_t;
+using ::beman::execution::when_all;
+using ::beman::execution::when_all_t;
+using ::beman::execution::when_all_with_variant;
+using ::beman::execution::when_all_with_variant_t;
+using ::beman::execution::with_awaitable_senders;
+using ::beman::execution::with_deadline;
+using ::beman::execution::with_deadline_t;
+using ::beman::execution::write_env;
+using ::beman::execution::write_env_t;
+} // namespace beman::execution
+
+// The pipe operator for sender adaptor closures is only found by argument
+// dependent lookup and needs to be exported explicitly.
+export namespace beman::execution::detail::pipeable {
+using ::beman::execution::detail::pipeable::operator|;
+} // namespace beman::execution::detail::pipeable
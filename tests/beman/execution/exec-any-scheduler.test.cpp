@@ -0,0 +1,174 @@
+// tests/beman/execution/exec-any-scheduler.test.cpp                -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <beman/execution/detail/any_scheduler.hpp>
+#include <beman/execution/detail/connect.hpp>
+#include <beman/execution/detail/default_domain.hpp>
+#include <beman/execution/detail/get_allocator.hpp>
+#include <beman/execution/detail/get_completion_scheduler.hpp>
+#include <beman/execution/detail/get_domain.hpp>
+#include <beman/execution/detail/get_env.hpp>
+#include <beman/execution/detail/get_stop_token.hpp>
+#include <beman/execution/detail/inplace_stop_source.hpp>
+#include <beman/execution/detail/receiver.hpp>
+#include <beman/execution/detail/run_loop.hpp>
+#include <beman/execution/detail/schedule.hpp>
+#include <beman/execution/detail/scheduler.hpp>
+#include <beman/execution/detail/start.hpp>
+#include <beman/execution/detail/trampoline_scheduler.hpp>
+#include <test/execution.hpp>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <utility>
+
+// ----------------------------------------------------------------------------
+
+namespace {
+template <typename T>
+struct counting_allocator {
+    using value_type = T;
+    std::size_t* count;
+
+    explicit counting_allocator(std::size_t* c) : count(c) {}
+    template <typename U>
+    counting_allocator(const counting_allocator<U>& other) : count(other.count) {}
+
+    auto allocate(std::size_t n) -> T* {
+        ++*this->count;
+        return std::allocator<T>().allocate(n);
+    }
+    auto deallocate(T* p, std::size_t n) -> void { std::allocator<T>().deallocate(p, n); }
+    auto operator==(const counting_allocator&) const -> bool = default;
+};
+
+struct env {
+    test_std::inplace_stop_token token;
+    std::size_t*                 count;
+
+    auto query(const test_std::get_stop_token_t&) const noexcept { return this->token; }
+    auto query(const test_std::get_allocator_t&) const noexcept { return counting_allocator<std::byte>(this->count); }
+};
+
+enum class completion : char { none, value, error, stopped };
+
+struct receiver {
+    using receiver_concept = test_std::receiver_t;
+    completion*                  comp;
+    std::size_t*                 count;
+    test_std::inplace_stop_token token{};
+
+    auto set_value() && noexcept -> void { *this->comp = completion::value; }
+    auto set_error(std::exception_ptr) && noexcept -> void { *this->comp = completion::error; }
+    auto set_stopped() && noexcept -> void { *this->comp = completion::stopped; }
+    auto get_env() const noexcept -> env { return {this->token, this->count}; }
+};
+
+struct large_scheduler {
+    using scheduler_concept = test_std::scheduler_t;
+    struct sender;
+
+    std::array<char, 64>           payload{};
+    test_std::trampoline_scheduler inner{};
+
+    auto schedule() const noexcept -> sender;
+    auto operator==(const large_scheduler&) const -> bool = default;
+};
+
+struct large_scheduler::sender {
+    struct env {
+        large_scheduler sched;
+        template <typename Tag>
+        auto query(const test_std::get_completion_scheduler_t<Tag>&) const noexcept -> large_scheduler {
+            return this->sched;
+        }
+    };
+
+    using sender_concept        = test_std::sender_t;
+    using completion_signatures = test_std::completion_signatures<test_std::set_value_t(), test_std::set_stopped_t()>;
+    large_scheduler sched;
+
+    auto get_env() const noexcept -> env { return {this->sched}; }
+    template <typename Receiver>
+    auto connect(Receiver&& rcvr) const {
+        return test_std::connect(test_std::schedule(this->sched.inner), std::forward<Receiver>(rcvr));
+    }
+};
+
+auto large_scheduler::schedule() const noexcept -> sender { return {*this}; }
+
+auto test_concepts() -> void {
+    static_assert(test_std::scheduler<test_std::any_scheduler>);
+    static_assert(test_std::scheduler<large_scheduler>);
+    static_assert(std::constructible_from<test_std::any_scheduler,
+                                          decltype(std::declval<test_std::run_loop&>().get_scheduler())>);
+    static_assert(std::constructible_from<test_std::any_scheduler, test_std::trampoline_scheduler>);
+    static_assert(std::constructible_from<test_std::any_scheduler, large_scheduler>);
+    static_assert(not std::constructible_from<test_std::any_scheduler, int>);
+}
+
+auto test_queries() -> void {
+    test_std::run_loop      loop1, loop2;
+    test_std::any_scheduler sched(loop1.get_scheduler());
+    test_std::any_scheduler copy(sched);
+    ASSERT(sched == copy);
+    ASSERT(sched == test_std::any_scheduler(loop1.get_scheduler()));
+    ASSERT(sched != test_std::any_scheduler(loop2.get_scheduler()));
+    ASSERT(sched != test_std::any_scheduler(test_std::trampoline_scheduler()));
+    copy = test_std::any_scheduler(test_std::trampoline_scheduler());
+    ASSERT(copy == test_std::any_scheduler(test_std::trampoline_scheduler()));
+
+    auto sndr{test_std::schedule(sched)};
+    ASSERT(sched == test_std::get_completion_scheduler<test_std::set_value_t>(test_std::get_env(sndr)));
+    static_assert(std::same_as<test_std::default_domain, decltype(test_std::get_domain(sched))>);
+}
+
+auto test_run_loop() -> void {
+    test_std::run_loop      loop;
+    test_std::any_scheduler sched(loop.get_scheduler());
+    completion              comp{};
+    std::size_t             count{};
+    auto                    op{test_std::connect(test_std::schedule(sched), receiver{&comp, &count})};
+    test_std::start(op);
+    ASSERT(comp == completion::none);
+    loop.finish();
+    loop.run();
+    ASSERT(comp == completion::value);
+    ASSERT(count == 0u);
+}
+
+auto test_large_scheduler() -> void {
+    test_std::any_scheduler sched{large_scheduler{}};
+    test_std::any_scheduler copy(sched);
+    test_std::any_scheduler moved(std::move(copy));
+    ASSERT(sched == moved);
+
+    completion  comp{};
+    std::size_t count{};
+    auto        op{test_std::connect(test_std::schedule(moved), receiver{&comp, &count})};
+    test_std::start(op);
+    ASSERT(comp == completion::value);
+    ASSERT(count == 0u);
+}
+
+auto test_stopped() -> void {
+    test_std::inplace_stop_source source;
+    source.request_stop();
+    test_std::any_scheduler sched(test_std::trampoline_scheduler{});
+    completion              comp{};
+    std::size_t             count{};
+    auto op{test_std::connect(test_std::schedule(sched), receiver{&comp, &count, source.get_token()})};
+    test_std::start(op);
+    ASSERT(comp == completion::stopped);
+}
+} // namespace
+
+TEST(exec_any_scheduler) {
+    test_concepts();
+    test_queries();
+    test_run_loop();
+    test_large_scheduler();
+    test_stopped();
+}
@@ -0,0 +1,225 @@
+// tests/beman/execution/exec-any-sender-of.test.cpp                -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <beman/execution/detail/any_sender_of.hpp>
+#include <beman/execution/detail/completion_signatures.hpp>
+#include <beman/execution/detail/connect.hpp>
+#include <beman/execution/detail/get_allocator.hpp>
+#include <beman/execution/detail/get_completion_signatures.hpp>
+#include <beman/execution/detail/get_env.hpp>
+#include <beman/execution/detail/get_stop_token.hpp>
+#include <beman/execution/detail/inplace_stop_source.hpp>
+#include <beman/execution/detail/just.hpp>
+#include <beman/execution/detail/operation_state.hpp>
+#include <beman/execution/detail/read_env.hpp>
+#include <beman/execution/detail/receiver.hpp>
+#include <beman/execution/detail/sender.hpp>
+#include <beman/execution/detail/set_stopped.hpp>
+#include <beman/execution/detail/start.hpp>
+#include <beman/execution/detail/stop_callback_for_t.hpp>
+#include <beman/execution/detail/stop_source.hpp>
+#include <beman/execution/detail/then.hpp>
+#include <test/execution.hpp>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+// ----------------------------------------------------------------------------
+
+namespace {
+using completions_t = test_std::completion_signatures<test_std::set_value_t(int),
+                                                      test_std::set_error_t(std::exception_ptr),
+                                                      test_std::set_stopped_t()>;
+using any_t         = test_std::any_sender_of<completions_t>;
+
+struct counts {
+    std::size_t allocated{};
+    std::size_t deallocated{};
+};
+
+template <typename T>
+struct counting_allocator {
+    using value_type = T;
+    counts* c;
+
+    explicit counting_allocator(counts* cnt) : c(cnt) {}
+    template <typename U>
+    counting_allocator(const counting_allocator<U>& other) : c(other.c) {}
+
+    auto allocate(std::size_t n) -> T* {
+        ++this->c->allocated;
+        return std::allocator<T>().allocate(n);
+    }
+    auto deallocate(T* p, std::size_t n) -> void {
+        ++this->c->deallocated;
+        std::allocator<T>().deallocate(p, n);
+    }
+    auto operator==(const counting_allocator&) const -> bool = default;
+};
+
+template <typename Token>
+struct env {
+    Token   token;
+    counts* c;
+
+    auto query(const test_std::get_stop_token_t&) const noexcept -> Token { return this->token; }
+    auto query(const test_std::get_allocator_t&) const noexcept -> counting_allocator<std::byte> {
+        return counting_allocator<std::byte>(this->c);
+    }
+};
+
+enum class completion : char { none, value, error, stopped };
+
+template <typename Token = test_std::inplace_stop_token>
+struct receiver {
+    using receiver_concept = test_std::receiver_t;
+
+    completion* comp;
+    int*        value;
+    counts*     c{};
+    Token       token{};
+
+    auto set_value(int v) && noexcept -> void {
+        *this->comp  = completion::value;
+        *this->value = v;
+    }
+    auto set_error(std::exception_ptr) && noexcept -> void { *this->comp = completion::error; }
+    auto set_stopped() && noexcept -> void { *this->comp = completion::stopped; }
+    auto get_env() const noexcept -> env<Token> { return {this->token, this->c}; }
+};
+
+struct wait_for_stop {
+    using sender_concept        = test_std::sender_t;
+    using completion_signatures = test_std::completion_signatures<test_std::set_stopped_t()>;
+
+    template <typename Receiver>
+    struct state {
+        using operation_state_concept = test_std::operation_state_t;
+        using token_t = decltype(test_std::get_stop_token(test_std::get_env(std::declval<const Receiver&>())));
+        struct cb_t {
+            Receiver* rcvr;
+            auto      operator()() noexcept -> void { test_std::set_stopped(std::move(*this->rcvr)); }
+        };
+
+        Receiver                                                    rcvr;
+        std::optional<test_std::stop_callback_for_t<token_t, cb_t>> cb{};
+
+        auto start() & noexcept -> void {
+            this->cb.emplace(test_std::get_stop_token(test_std::get_env(this->rcvr)), cb_t{&this->rcvr});
+        }
+    };
+
+    template <typename Receiver>
+    auto connect(Receiver&& rcvr) const -> state<std::remove_cvref_t<Receiver>> {
+        return {std::forward<Receiver>(rcvr)};
+    }
+};
+
+template <typename Sender, typename Receiver>
+auto run(Sender&& sndr, Receiver rcvr) -> void {
+    auto op{test_std::connect(std::forward<Sender>(sndr), std::move(rcvr))};
+    test_std::start(op);
+}
+
+auto test_concepts() -> void {
+    static_assert(test_std::sender<any_t>);
+    static_assert(std::same_as<completions_t, test_std::completion_signatures_of_t<any_t, test_std::empty_env>>);
+    static_assert(std::constructible_from<any_t, decltype(test_std::just(1))>);
+    static_assert(std::constructible_from<any_t, decltype(test_std::just_stopped())>);
+    static_assert(not std::constructible_from<any_t, decltype(test_std::just(1, 2))>);
+    static_assert(not std::copy_constructible<any_t>);
+    static_assert(std::move_constructible<any_t>);
+}
+
+auto test_inline_sender() -> void {
+    completion comp{};
+    int        value{};
+    run(any_t(test_std::just(17)), receiver<>{&comp, &value});
+    ASSERT(comp == completion::value);
+    ASSERT(value == 17);
+
+    any_t sndr(test_std::just_stopped());
+    any_t moved(std::move(sndr));
+    run(std::move(moved), receiver<>{&comp, &value});
+    ASSERT(comp == completion::stopped);
+}
+
+auto test_allocated_sender() -> void {
+    std::array<int, 64> data{};
+    data.back() = 42;
+    any_t sndr(test_std::just(2) | test_std::then([data](int v) { return v * data.back(); }));
+    any_t moved{test_std::just(0)};
+    moved = std::move(sndr);
+
+    counts     c{};
+    completion comp{};
+    int        value{};
+    run(std::move(moved), receiver<>{&comp, &value, &c});
+    ASSERT(comp == completion::value);
+    ASSERT(value == 84);
+    ASSERT(c.allocated == 1u);
+    ASSERT(c.deallocated == 1u);
+}
+
+auto test_state_allocation() -> void {
+    counts     c{};
+    completion comp{};
+    int        value{};
+
+    run(any_t(test_std::just(1)), receiver<>{&comp, &value, &c});
+    ASSERT(comp == completion::value);
+    ASSERT(c.allocated == 0u);
+
+    using small_t = test_std::any_sender_of<completions_t, 0u, 0u>;
+    run(small_t(test_std::just(2)), receiver<>{&comp, &value, &c});
+    ASSERT(comp == completion::value);
+    ASSERT(value == 2);
+    ASSERT(c.allocated == 1u);
+    ASSERT(c.deallocated == 1u);
+}
+
+template <typename Source>
+auto test_stop(Source& source) -> void {
+    completion comp{};
+    int        value{};
+    auto       op{test_std::connect(any_t(wait_for_stop{}),
+                              receiver<decltype(source.get_token())>{&comp, &value, nullptr, source.get_token()})};
+    test_std::start(op);
+    ASSERT(comp == completion::none);
+    source.request_stop();
+    ASSERT(comp == completion::stopped);
+}
+
+auto test_queries() -> void {
+    using allocator_t = counting_allocator<std::byte>;
+    using query_t     = test_std::any_sender_of<completions_t,
+                                                4u * sizeof(void*),
+                                                16u * sizeof(void*),
+                                                allocator_t(test_std::get_allocator_t)>;
+    counts     c{};
+    completion comp{};
+    int        value{};
+    run(query_t(test_std::read_env(test_std::get_allocator) |
+                test_std::then([&c](const allocator_t& alloc) { return alloc.c == &c ? 17 : 0; })),
+        receiver<>{&comp, &value, &c});
+    ASSERT(comp == completion::value);
+    ASSERT(value == 17);
+}
+} // namespace
+
+TEST(exec_any_sender_of) {
+    test_concepts();
+    test_inline_sender();
+    test_allocated_sender();
+    test_state_allocation();
+    test_std::inplace_stop_source inplace_source;
+    test_stop(inplace_source);
+    test_std::stop_source source;
+    test_stop(source);
+    test_queries();
+}
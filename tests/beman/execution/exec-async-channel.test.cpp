@@ -0,0 +1,188 @@
+// tests/beman/execution/exec-async-channel.test.cpp                -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <beman/execution/detail/async_channel.hpp>
+#include <beman/execution/detail/connect.hpp>
+#include <beman/execution/detail/get_completion_signatures.hpp>
+#include <beman/execution/detail/get_stop_token.hpp>
+#include <beman/execution/detail/inplace_stop_source.hpp>
+#include <beman/execution/detail/receiver.hpp>
+#include <beman/execution/detail/sender.hpp>
+#include <beman/execution/detail/start.hpp>
+#include <test/execution.hpp>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+// ----------------------------------------------------------------------------
+
+namespace {
+struct env {
+    test_std::inplace_stop_token token;
+    auto                         query(const test_std::get_stop_token_t&) const noexcept { return this->token; }
+};
+
+struct send_receiver {
+    using receiver_concept = test_std::receiver_t;
+    std::string*                 log;
+    char                         id;
+    test_std::inplace_stop_token token{};
+
+    auto set_value() && noexcept -> void { *this->log += this->id; }
+    auto set_stopped() && noexcept -> void { *this->log += '-'; }
+    auto get_env() const noexcept -> env { return {this->token}; }
+};
+
+struct receive_receiver {
+    using receiver_concept = test_std::receiver_t;
+    std::string*                 log;
+    test_std::inplace_stop_token token{};
+
+    auto set_value(char c) && noexcept -> void { *this->log += c; }
+    auto set_stopped() && noexcept -> void { *this->log += '-'; }
+    auto get_env() const noexcept -> env { return {this->token}; }
+};
+
+auto test_concepts() -> void {
+    test_std::async_channel<char> channel(4u);
+    ASSERT(channel.capacity() == 4u);
+    ASSERT(test_std::async_channel<char>(0u).capacity() == 1u);
+    static_assert(test_std::sender<decltype(channel.send('a'))>);
+    static_assert(test_std::sender<decltype(channel.receive())>);
+    static_assert(
+        std::same_as<test_std::completion_signatures<test_std::set_value_t(char), test_std::set_stopped_t()>,
+                     decltype(test_std::get_completion_signatures(channel.receive(), test_std::empty_env{}))>);
+}
+
+auto test_backpressure() -> void {
+    test_std::async_channel<char> channel(2u);
+    std::string                   sent;
+    std::string                   received;
+    auto                          s0{test_std::connect(channel.send('a'), send_receiver{&sent, 'a'})};
+    auto                          s1{test_std::connect(channel.send('b'), send_receiver{&sent, 'b'})};
+    auto                          s2{test_std::connect(channel.send('c'), send_receiver{&sent, 'c'})};
+    test_std::start(s0);
+    test_std::start(s1);
+    ASSERT(sent == "ab");
+    test_std::start(s2);
+    ASSERT(sent == "ab");
+
+    auto r0{test_std::connect(channel.receive(), receive_receiver{&received})};
+    test_std::start(r0);
+    ASSERT(received == "a");
+    ASSERT(sent == "abc");
+
+    auto r1{test_std::connect(channel.receive(), receive_receiver{&received})};
+    auto r2{test_std::connect(channel.receive(), receive_receiver{&received})};
+    auto r3{test_std::connect(channel.receive(), receive_receiver{&received})};
+    test_std::start(r1);
+    test_std::start(r2);
+    ASSERT(received == "abc");
+    test_std::start(r3);
+    ASSERT(received == "abc");
+
+    auto s3{test_std::connect(channel.send('d'), send_receiver{&sent, 'd'})};
+    test_std::start(s3);
+    ASSERT(sent == "abcd");
+    ASSERT(received == "abcd");
+}
+
+auto test_cancel() -> void {
+    test_std::async_channel<char> channel(1u);
+    test_std::inplace_stop_source source;
+    std::string                   sent;
+    std::string                   received;
+
+    auto r0{test_std::connect(channel.receive(), receive_receiver{&received, source.get_token()})};
+    test_std::start(r0);
+    source.request_stop();
+    ASSERT(received == "-");
+
+    test_std::inplace_stop_source source1;
+    auto                          s0{test_std::connect(channel.send('a'), send_receiver{&sent, 'a'})};
+    auto s1{test_std::connect(channel.send('b'), send_receiver{&sent, 'b', source1.get_token()})};
+    test_std::start(s0);
+    test_std::start(s1);
+    source1.request_stop();
+    ASSERT(sent == "a-");
+
+    auto r1{test_std::connect(channel.receive(), receive_receiver{&received})};
+    test_std::start(r1);
+    ASSERT(received == "-a");
+}
+
+auto test_cleanup() -> void {
+    auto value{std::make_shared<int>(17)};
+    {
+        test_std::async_channel<std::shared_ptr<int>> channel(4u);
+        std::string                                   sent;
+        auto op{test_std::connect(channel.send(value), send_receiver{&sent, 'a'})};
+        test_std::start(op);
+        ASSERT(value.use_count() == 2);
+    }
+    ASSERT(value.use_count() == 1);
+}
+
+template <typename Op>
+auto run_and_wait(Op& op, std::atomic<bool>& done) -> void {
+    test_std::start(op);
+    while (not done.load(std::memory_order_acquire))
+        std::this_thread::yield();
+}
+
+struct flag_receiver {
+    using receiver_concept = test_std::receiver_t;
+    std::atomic<bool>* done;
+    std::size_t*       sum{};
+
+    auto set_value() && noexcept -> void { this->done->store(true, std::memory_order_release); }
+    auto set_value(std::size_t value) && noexcept -> void {
+        *this->sum += value;
+        this->done->store(true, std::memory_order_release);
+    }
+    auto set_stopped() && noexcept -> void {}
+};
+
+auto test_threads() -> void {
+    static constexpr std::size_t         threads{2u};
+    static constexpr std::size_t         messages{10000u};
+    test_std::async_channel<std::size_t> channel(8u);
+    std::vector<std::size_t>             sums(threads);
+    std::vector<std::thread>             workers;
+    for (std::size_t t{}; t != threads; ++t) {
+        workers.emplace_back([&channel, t] {
+            for (std::size_t i{}; i != messages; ++i) {
+                std::atomic<bool> done{};
+                auto              op{test_std::connect(channel.send(t * messages + i), flag_receiver{&done})};
+                run_and_wait(op, done);
+            }
+        });
+        workers.emplace_back([&channel, &sums, t] {
+            for (std::size_t i{}; i != messages; ++i) {
+                std::atomic<bool> done{};
+                auto              op{test_std::connect(channel.receive(), flag_receiver{&done, &sums[t]})};
+                run_and_wait(op, done);
+            }
+        });
+    }
+    for (auto& w : workers)
+        w.join();
+    std::size_t total{};
+    for (std::size_t s : sums)
+        total += s;
+    std::size_t count{threads * messages};
+    ASSERT(total == count * (count - 1u) / 2u);
+}
+} // namespace
+
+TEST(exec_async_channel) {
+    test_concepts();
+    test_backpressure();
+    test_cancel();
+    test_cleanup();
+    test_threads();
+}
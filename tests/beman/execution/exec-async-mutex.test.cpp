@@ -0,0 +1,131 @@
+// tests/beman/execution/exec-async-mutex.test.cpp                  -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <beman/execution/detail/async_mutex.hpp>
+#include <beman/execution/detail/connect.hpp>
+#include <beman/execution/detail/connect_result_t.hpp>
+#include <beman/execution/detail/get_completion_signatures.hpp>
+#include <beman/execution/detail/get_stop_token.hpp>
+#include <beman/execution/detail/inplace_stop_source.hpp>
+#include <beman/execution/detail/receiver.hpp>
+#include <beman/execution/detail/sender.hpp>
+#include <beman/execution/detail/start.hpp>
+#include <test/execution.hpp>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+
+// ----------------------------------------------------------------------------
+
+namespace {
+struct env {
+    test_std::inplace_stop_token token;
+    auto                         query(const test_std::get_stop_token_t&) const noexcept { return this->token; }
+};
+
+struct receiver {
+    using receiver_concept = test_std::receiver_t;
+    std::string*                 log;
+    char                         id;
+    test_std::inplace_stop_token token{};
+
+    auto set_value() && noexcept -> void { *this->log += this->id; }
+    auto set_stopped() && noexcept -> void { *this->log += '-'; }
+    auto get_env() const noexcept -> env { return {this->token}; }
+};
+
+struct flag_receiver {
+    using receiver_concept = test_std::receiver_t;
+    std::atomic<bool>* flag;
+
+    auto set_value() && noexcept -> void { this->flag->store(true, std::memory_order_release); }
+    auto set_stopped() && noexcept -> void {}
+};
+
+auto test_concepts() -> void {
+    test_std::async_mutex mtx;
+    static_assert(test_std::sender<decltype(mtx.lock())>);
+    static_assert(std::same_as<test_std::completion_signatures<test_std::set_value_t(), test_std::set_stopped_t()>,
+                               decltype(test_std::get_completion_signatures(mtx.lock(), test_std::empty_env{}))>);
+    ASSERT(mtx.try_lock());
+    ASSERT(not mtx.try_lock());
+    mtx.unlock();
+    ASSERT(mtx.try_lock());
+    mtx.unlock();
+}
+
+auto test_fifo() -> void {
+    test_std::async_mutex mtx;
+    std::string           log;
+    auto                  op0{test_std::connect(mtx.lock(), receiver{&log, 'a'})};
+    auto                  op1{test_std::connect(mtx.lock(), receiver{&log, 'b'})};
+    auto                  op2{test_std::connect(mtx.lock(), receiver{&log, 'c'})};
+    test_std::start(op0);
+    ASSERT(log == "a");
+    test_std::start(op1);
+    test_std::start(op2);
+    ASSERT(log == "a");
+    mtx.unlock();
+    ASSERT(log == "ab");
+    mtx.unlock();
+    ASSERT(log == "abc");
+    ASSERT(not mtx.try_lock());
+    mtx.unlock();
+    ASSERT(mtx.try_lock());
+}
+
+auto test_cancel() -> void {
+    test_std::async_mutex         mtx;
+    test_std::inplace_stop_source source;
+    std::string                   log;
+    ASSERT(mtx.try_lock());
+    auto op0{test_std::connect(mtx.lock(), receiver{&log, 'a', source.get_token()})};
+    auto op1{test_std::connect(mtx.lock(), receiver{&log, 'b'})};
+    test_std::start(op0);
+    test_std::start(op1);
+    ASSERT(log == "");
+    source.request_stop();
+    ASSERT(log == "-");
+    mtx.unlock();
+    ASSERT(log == "-b");
+
+    auto op2{test_std::connect(mtx.lock(), receiver{&log, 'c', source.get_token()})};
+    test_std::start(op2);
+    ASSERT(log == "-b-");
+}
+
+auto test_threads() -> void {
+    static constexpr std::size_t threads{4u};
+    static constexpr std::size_t iterations{5000u};
+    test_std::async_mutex        mtx;
+    std::size_t                  counter{};
+    std::vector<std::thread>     workers;
+    for (std::size_t t{}; t != threads; ++t) {
+        workers.emplace_back([&] {
+            for (std::size_t i{}; i != iterations; ++i) {
+                std::atomic<bool> locked{};
+                auto              op{test_std::connect(mtx.lock(), flag_receiver{&locked})};
+                test_std::start(op);
+                while (not locked.load(std::memory_order_acquire)) {
+                    std::this_thread::yield();
+                }
+                ++counter;
+                mtx.unlock();
+            }
+        });
+    }
+    for (auto& w : workers)
+        w.join();
+    ASSERT(counter == threads * iterations);
+}
+} // namespace
+
+TEST(exec_async_mutex) {
+    test_concepts();
+    test_fifo();
+    test_cancel();
+    test_threads();
+}
@@ -0,0 +1,200 @@
+// tests/beman/execution/exec-async-sync.test.cpp                   -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <beman/execution/detail/async_barrier.hpp>
+#include <beman/execution/detail/async_latch.hpp>
+#include <beman/execution/detail/async_manual_reset_event.hpp>
+#include <beman/execution/detail/connect.hpp>
+#include <beman/execution/detail/connect_result_t.hpp>
+#include <beman/execution/detail/emplace_from.hpp>
+#include <beman/execution/detail/get_completion_signatures.hpp>
+#include <beman/execution/detail/receiver.hpp>
+#include <beman/execution/detail/sender.hpp>
+#include <beman/execution/detail/start.hpp>
+#include <test/execution.hpp>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <list>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// ----------------------------------------------------------------------------
+
+namespace {
+struct receiver {
+    using receiver_concept = test_std::receiver_t;
+    std::string* log;
+    char         id;
+
+    auto set_value() && noexcept -> void { *this->log += this->id; }
+};
+
+struct count_receiver {
+    using receiver_concept = test_std::receiver_t;
+    std::atomic<int>* count;
+
+    auto set_value() && noexcept -> void { this->count->fetch_add(1, std::memory_order_acq_rel); }
+};
+
+template <typename Sender, typename Receiver>
+using ops_t = std::list<test_std::connect_result_t<Sender, Receiver>>;
+
+template <typename Sender, typename Receiver>
+auto start(ops_t<Sender, Receiver>& ops, Sender sndr, Receiver rcvr) -> void {
+    ops.emplace_back(test_detail::emplace_from([&] { return test_std::connect(std::move(sndr), std::move(rcvr)); }));
+    test_std::start(ops.back());
+}
+
+template <typename Sender>
+auto check_sender(Sender) -> void {
+    static_assert(test_std::sender<Sender>);
+    static_assert(std::same_as<test_std::completion_signatures<test_std::set_value_t()>,
+                               decltype(test_std::get_completion_signatures(std::declval<Sender>(),
+                                                                            test_std::empty_env{}))>);
+}
+
+auto test_event() -> void {
+    using sender = test_std::async_manual_reset_event::sender;
+    test_std::async_manual_reset_event event;
+    check_sender(event.wait());
+    ASSERT(not event.is_set());
+
+    std::string             log;
+    ops_t<sender, receiver> ops;
+    start(ops, event.wait(), receiver{&log, 'a'});
+    start(ops, event.wait(), receiver{&log, 'b'});
+    start(ops, event.wait(), receiver{&log, 'c'});
+    ASSERT(log.empty());
+    event.set();
+    ASSERT(event.is_set());
+    ASSERT(log == "abc");
+
+    // waiting on a set event completes inline
+    start(ops, event.wait(), receiver{&log, 'd'});
+    ASSERT(log == "abcd");
+    event.set();
+    ASSERT(log == "abcd");
+
+    event.reset();
+    ASSERT(not event.is_set());
+    start(ops, event.wait(), receiver{&log, 'e'});
+    ASSERT(log == "abcd");
+    event.set();
+    ASSERT(log == "abcde");
+
+    test_std::async_manual_reset_event initially_set(true);
+    ASSERT(initially_set.is_set());
+    start(ops, initially_set.wait(), receiver{&log, 'f'});
+    ASSERT(log == "abcdef");
+}
+
+auto test_latch() -> void {
+    test_std::async_latch latch(3);
+    check_sender(latch.wait());
+    check_sender(latch.arrive_and_wait());
+
+    std::string                                           log;
+    ops_t<test_std::async_latch::sender, receiver>        waits;
+    ops_t<test_std::async_latch::arrive_sender, receiver> arrivals;
+    start(waits, latch.wait(), receiver{&log, 'a'});
+    start(arrivals, latch.arrive_and_wait(), receiver{&log, 'b'});
+    ASSERT(log.empty());
+    ASSERT(not latch.try_wait());
+    latch.count_down();
+    ASSERT(log.empty());
+    start(arrivals, latch.arrive_and_wait(), receiver{&log, 'c'});
+    ASSERT(latch.try_wait());
+    ASSERT(log == "abc");
+    start(waits, latch.wait(), receiver{&log, 'd'});
+    ASSERT(log == "abcd");
+
+    test_std::async_latch done(0);
+    ASSERT(done.try_wait());
+    start(waits, done.wait(), receiver{&log, 'e'});
+    ASSERT(log == "abcde");
+}
+
+auto test_barrier() -> void {
+    using sender = test_std::async_barrier::sender;
+    test_std::async_barrier barrier(3);
+    check_sender(barrier.arrive_and_wait());
+
+    std::string             log;
+    ops_t<sender, receiver> ops;
+    for (char phase : {'a', 'd'}) {
+        start(ops, barrier.arrive_and_wait(), receiver{&log, phase});
+        start(ops, barrier.arrive_and_wait(), receiver{&log, char(phase + 1)});
+        ASSERT(log.size() == std::size_t(phase - 'a'));
+        start(ops, barrier.arrive_and_wait(), receiver{&log, char(phase + 2)});
+    }
+    ASSERT(log == "abcdef");
+
+    // arrivals without waiting and dropped participants
+    start(ops, barrier.arrive_and_wait(), receiver{&log, 'g'});
+    barrier.arrive();
+    ASSERT(log == "abcdef");
+    barrier.arrive_and_drop();
+    ASSERT(log == "abcdefg");
+    start(ops, barrier.arrive_and_wait(), receiver{&log, 'h'});
+    ASSERT(log == "abcdefg");
+    start(ops, barrier.arrive_and_wait(), receiver{&log, 'i'});
+    ASSERT(log == "abcdefghi");
+}
+
+auto test_many_waiters() -> void {
+    constexpr int                                          waiters{5000};
+    std::atomic<int>                                       count{};
+    test_std::async_barrier                                barrier(waiters);
+    ops_t<test_std::async_barrier::sender, count_receiver> ops;
+    for (int i{}; i != waiters - 1; ++i)
+        start(ops, barrier.arrive_and_wait(), count_receiver{&count});
+    ASSERT(count == 0);
+    start(ops, barrier.arrive_and_wait(), count_receiver{&count});
+    ASSERT(count == waiters);
+}
+
+auto test_threads() -> void {
+    constexpr int    threads{4};
+    constexpr int    rounds{200};
+    std::atomic<int> set_count{};
+    std::atomic<int> latch_count{};
+    std::atomic<int> barrier_count{};
+    {
+        test_std::async_manual_reset_event                                             event;
+        test_std::async_latch                                                          latch(threads);
+        test_std::async_barrier                                                        barrier(threads);
+        std::vector<ops_t<test_std::async_manual_reset_event::sender, count_receiver>> event_ops(threads);
+        std::vector<ops_t<test_std::async_latch::arrive_sender, count_receiver>>       latch_ops(threads);
+        std::vector<ops_t<test_std::async_barrier::sender, count_receiver>>            barrier_ops(threads);
+        std::vector<std::thread>                                                       workers;
+        for (int t{}; t != threads; ++t)
+            workers.emplace_back([&, t] {
+                for (int r{}; r != rounds; ++r)
+                    start(event_ops[std::size_t(t)], event.wait(), count_receiver{&set_count});
+                start(latch_ops[std::size_t(t)], latch.arrive_and_wait(), count_receiver{&latch_count});
+                for (int r{}; r != rounds; ++r) {
+                    start(barrier_ops[std::size_t(t)], barrier.arrive_and_wait(), count_receiver{&barrier_count});
+                    while (barrier_count.load(std::memory_order_acquire) < (r + 1) * threads)
+                        std::this_thread::yield();
+                }
+            });
+        event.set();
+        for (auto& w : workers)
+            w.join();
+    }
+    ASSERT(set_count == threads * rounds);
+    ASSERT(latch_count == threads);
+    ASSERT(barrier_count == threads * rounds);
+}
+} // namespace
+
+TEST(exec_async_sync) {
+    test_event();
+    test_latch();
+    test_barrier();
+    test_many_waiters();
+    test_threads();
+}
@@ -0,0 +1,320 @@
+// tests/beman/execution/exec-batch.test.cpp                        -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <beman/execution/detail/batch.hpp>
+#include <beman/execution/detail/connect.hpp>
+#include <beman/execution/detail/get_completion_signatures.hpp>
+#include <beman/execution/detail/get_stop_token.hpp>
+#include <beman/execution/detail/inplace_stop_source.hpp>
+#include <beman/execution/detail/receiver.hpp>
+#include <beman/execution/detail/sender.hpp>
+#include <beman/execution/detail/start.hpp>
+#include <beman/execution/detail/timer_context.hpp>
+#include <test/execution.hpp>
+#include <atomic>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+// ----------------------------------------------------------------------------
+
+namespace {
+using namespace std::chrono_literals;
+
+struct env {
+    test_std::inplace_stop_token token;
+    auto                         query(const test_std::get_stop_token_t&) const noexcept { return this->token; }
+};
+
+enum class completion : char { none, value, error, stopped };
+
+struct result {
+    std::atomic<completion> comp{completion::none};
+    int                     value{};
+};
+
+struct receiver {
+    using receiver_concept = test_std::receiver_t;
+    result*                      res;
+    test_std::inplace_stop_token token{};
+
+    auto set_value(int v) && noexcept -> void {
+        this->res->value = v;
+        this->res->comp.store(completion::value, std::memory_order_release);
+    }
+    auto set_error(std::exception_ptr) && noexcept -> void {
+        this->res->comp.store(completion::error, std::memory_order_release);
+    }
+    auto set_stopped() && noexcept -> void { this->res->comp.store(completion::stopped, std::memory_order_release); }
+    auto get_env() const noexcept -> env { return {this->token}; }
+};
+
+struct doubler {
+    std::atomic<std::size_t>* calls;
+    std::atomic<std::size_t>* last_size;
+
+    auto operator()(std::span<int> inputs) const -> std::vector<int> {
+        ++*this->calls;
+        *this->last_size = inputs.size();
+        std::vector<int> rc;
+        for (int i : inputs)
+            rc.push_back(2 * i);
+        return rc;
+    }
+};
+
+auto wait_for(result& res) -> void {
+    while (res.comp.load(std::memory_order_acquire) == completion::none)
+        std::this_thread::yield();
+}
+
+auto test_concepts() -> void {
+    std::atomic<std::size_t>      calls{};
+    std::atomic<std::size_t>      size{};
+    test_std::batch<int, doubler> b(4u, 1ms, doubler{&calls, &size});
+    static_assert(std::same_as<int, test_std::batch<int, doubler>::result_type>);
+    static_assert(test_std::sender<decltype(b.submit(1))>);
+    static_assert(std::same_as<test_std::completion_signatures<test_std::set_value_t(int),
+                                                               test_std::set_error_t(std::exception_ptr),
+                                                               test_std::set_stopped_t()>,
+                               decltype(test_std::get_completion_signatures(b.submit(1), test_std::empty_env{}))>);
+    ASSERT(b.max_size() == 4u);
+    test_std::batch<int, doubler> b0(0u, 1ms, doubler{&calls, &size});
+    ASSERT(b0.max_size() == 1u);
+}
+
+auto test_full() -> void {
+    std::atomic<std::size_t>      calls{};
+    std::atomic<std::size_t>      size{};
+    test_std::batch<int, doubler> b(3u, 1h, doubler{&calls, &size});
+    result                        r0, r1, r2;
+    auto                          op0{test_std::connect(b.submit(1), receiver{&r0})};
+    auto                          op1{test_std::connect(b.submit(2), receiver{&r1})};
+    auto                          op2{test_std::connect(b.submit(3), receiver{&r2})};
+    test_std::start(op0);
+    test_std::start(op1);
+    ASSERT(r0.comp == completion::none);
+    ASSERT(calls == 0u);
+    test_std::start(op2);
+    ASSERT(calls == 1u);
+    ASSERT(size == 3u);
+    ASSERT(r0.comp == completion::value && r0.value == 2);
+    ASSERT(r1.comp == completion::value && r1.value == 4);
+    ASSERT(r2.comp == completion::value && r2.value == 6);
+}
+
+auto test_deadline() -> void {
+    std::atomic<std::size_t>      calls{};
+    std::atomic<std::size_t>      size{};
+    test_std::batch<int, doubler> b(100u, 5ms, doubler{&calls, &size});
+    result                        r0, r1;
+    auto                          op0{test_std::connect(b.submit(5), receiver{&r0})};
+    auto                          op1{test_std::connect(b.submit(6), receiver{&r1})};
+    test_std::start(op0);
+    test_std::start(op1);
+    wait_for(r0);
+    wait_for(r1);
+    ASSERT(calls == 1u);
+    ASSERT(size == 2u);
+    ASSERT(r0.value == 10);
+    ASSERT(r1.value == 12);
+}
+
+auto test_timer_context() -> void {
+    using clock = std::chrono::steady_clock;
+    std::atomic<std::size_t> calls{};
+    std::atomic<std::size_t> size{};
+    test_std::timer_context  timer;
+    {
+        test_std::batch<int, doubler> b(2u, 20ms, doubler{&calls, &size}, timer);
+        ASSERT(timer.size() == 0u);
+
+        // the full batch leaves the deadline entry of its first input pending
+        result r0, r1;
+        auto   op0{test_std::connect(b.submit(1), receiver{&r0})};
+        auto   op1{test_std::connect(b.submit(2), receiver{&r1})};
+        test_std::start(op0);
+        ASSERT(timer.size() == 1u);
+        test_std::start(op1);
+        ASSERT(r0.value == 2 && r1.value == 4);
+
+        // a later batch is flushed no earlier than its own deadline
+        std::this_thread::sleep_for(10ms);
+        result r2;
+        auto   op2{test_std::connect(b.submit(3), receiver{&r2})};
+        auto   submitted{clock::now()};
+        test_std::start(op2);
+        wait_for(r2);
+        ASSERT(20ms <= clock::now() - submitted);
+        ASSERT(r2.value == 6);
+        ASSERT(calls == 2u);
+    }
+    ASSERT(timer.size() == 0u);
+}
+
+auto test_cancel() -> void {
+    std::atomic<std::size_t>      calls{};
+    std::atomic<std::size_t>      size{};
+    test_std::batch<int, doubler> b(2u, 1h, doubler{&calls, &size});
+    test_std::inplace_stop_source source;
+    result                        r0, r1, r2;
+    auto                          op0{test_std::connect(b.submit(1), receiver{&r0, source.get_token()})};
+    auto                          op1{test_std::connect(b.submit(2), receiver{&r1})};
+    auto                          op2{test_std::connect(b.submit(3), receiver{&r2})};
+    test_std::start(op0);
+    source.request_stop();
+    ASSERT(r0.comp == completion::stopped);
+    test_std::start(op1);
+    ASSERT(calls == 0u);
+    test_std::start(op2);
+    ASSERT(calls == 1u);
+    ASSERT(r1.value == 4);
+    ASSERT(r2.value == 6);
+}
+
+auto test_error() -> void {
+    auto fn{[](std::span<int>) -> std::vector<int> { throw std::runtime_error("batch failed"); }};
+    test_std::batch<int, decltype(fn)> b(2u, 1h, fn);
+    result                             r0, r1;
+    auto                               op0{test_std::connect(b.submit(1), receiver{&r0})};
+    auto                               op1{test_std::connect(b.submit(2), receiver{&r1})};
+    test_std::start(op0);
+    test_std::start(op1);
+    ASSERT(r0.comp == completion::error);
+    ASSERT(r1.comp == completion::error);
+
+    auto short_fn{[](std::span<int>) { return std::vector<int>{}; }};
+    test_std::batch<int, decltype(short_fn)> b1(1u, 1h, short_fn);
+    result                                   r2;
+    auto                                     op2{test_std::connect(b1.submit(1), receiver{&r2})};
+    test_std::start(op2);
+    ASSERT(r2.comp == completion::error);
+}
+
+auto test_destroy() -> void {
+    std::atomic<std::size_t>                     calls{};
+    std::atomic<std::size_t>                     size{};
+    result                                       r0;
+    std::optional<test_std::batch<int, doubler>> b;
+    b.emplace(100u, 1h, doubler{&calls, &size});
+    auto op0{test_std::connect(b->submit(21), receiver{&r0})};
+    test_std::start(op0);
+    ASSERT(r0.comp == completion::none);
+    b.reset();
+    ASSERT(calls == 1u);
+    ASSERT(r0.comp == completion::value && r0.value == 42);
+}
+
+auto test_threads() -> void {
+    static constexpr int          threads{4};
+    static constexpr int          submissions{1000};
+    std::atomic<std::size_t>      calls{};
+    std::atomic<std::size_t>      size{};
+    test_std::batch<int, doubler> b(8u, 1ms, doubler{&calls, &size});
+    std::atomic<long>             total{};
+    std::vector<std::thread>      workers;
+    for (int t{}; t != threads; ++t) {
+        workers.emplace_back([&b, &total] {
+            for (int i{}; i != submissions; ++i) {
+                result res;
+                auto   op{test_std::connect(b.submit(i), receiver{&res})};
+                test_std::start(op);
+                wait_for(res);
+                total += res.value;
+            }
+        });
+    }
+    for (auto& w : workers)
+        w.join();
+    ASSERT(total == long(threads) * submissions * (submissions - 1));
+    ASSERT(calls <= std::size_t(threads * submissions));
+}
+
+auto test_serial() -> void {
+    // full batches get flushed by the submitters while batches reaching their
+    // deadline get flushed by the timer thread: the batch function still runs
+    // for one batch at a time
+    static constexpr int threads{4};
+    static constexpr int submissions{200};
+    std::atomic<int>     active{};
+    std::atomic<bool>    overlap{};
+    std::atomic<int>     calls{};
+    auto                 fn{[&](std::span<int> inputs) {
+        if (0 != active++)
+            overlap = true;
+        ++calls;
+        std::this_thread::sleep_for(50us);
+        std::vector<int> rc(inputs.begin(), inputs.end());
+        --active;
+        return rc;
+    }};
+    test_std::batch<int, decltype(fn)> b(2u, 100us, fn);
+    std::atomic<long>                  total{};
+    std::vector<std::thread>           workers;
+    for (int t{}; t != threads; ++t) {
+        workers.emplace_back([&b, &total, t] {
+            for (int i{}; i != submissions; ++i) {
+                result res;
+                auto   op{test_std::connect(b.submit(i), receiver{&res})};
+                test_std::start(op);
+                if ((i + t) % 3 == 0)
+                    std::this_thread::sleep_for(100us);
+                wait_for(res);
+                total += res.value;
+            }
+        });
+    }
+    for (auto& w : workers)
+        w.join();
+    ASSERT(not overlap);
+    ASSERT(0 < calls);
+    ASSERT(total == long(threads) * submissions * (submissions - 1) / 2);
+}
+
+auto test_reentrant() -> void {
+    // a receiver submitting a full batch from its completion doesn't recurse into the batch function
+    std::atomic<std::size_t>      calls{};
+    std::atomic<std::size_t>      size{};
+    test_std::batch<int, doubler> b(1u, 1h, doubler{&calls, &size});
+    result                        inner;
+    std::unique_ptr<decltype(test_std::connect(b.submit(0), receiver{&inner}))> op1;
+    struct outer_receiver {
+        using receiver_concept = test_std::receiver_t;
+        std::function<void()> fun;
+        auto                  set_value(int) && noexcept -> void { this->fun(); }
+        auto                  set_error(std::exception_ptr) && noexcept -> void {}
+        auto                  set_stopped() && noexcept -> void {}
+    };
+    std::size_t depth{};
+    auto        op0{test_std::connect(b.submit(1), outer_receiver{[&] {
+        op1.reset(new auto(test_std::connect(b.submit(2), receiver{&inner})));
+        test_std::start(*op1);
+        depth = calls;
+    }})};
+    test_std::start(op0);
+    ASSERT(depth == 1u);
+    ASSERT(calls == 2u);
+    ASSERT(inner.comp == completion::value && inner.value == 4);
+}
+} // namespace
+
+TEST(exec_batch) {
+    test_concepts();
+    test_full();
+    test_deadline();
+    test_timer_context();
+    test_cancel();
+    test_error();
+    test_destroy();
+    test_threads();
+    test_serial();
+    test_reentrant();
+}
@@ -6,9 +6,12 @@
 #include <beman/execution/detail/operation_state_task.hpp>
 #include <beman/execution/detail/suspend_complete.hpp>
 #include <beman/execution/detail/connect_awaitable.hpp>
+#include <beman/execution/detail/get_allocator.hpp>
 #include <test/execution.hpp>
 
 #include <concepts>
+#include <cstddef>
+#include <memory>
 #include <stdexcept>
 
 // ----------------------------------------------------------------------------
@@ -125,6 +128,52 @@ struct transformed {
     auto as_awaitable(auto&&) -> awaiter { return {}; }
 };
 
+struct counts {
+    std::size_t allocated{};
+    std::size_t deallocated{};
+};
+
+template <typename T>
+struct counting_allocator {
+    using value_type = T;
+    counts* c;
+
+    explicit counting_allocator(counts* cn) : c(cn) {}
+    template <typename U>
+    counting_allocator(const counting_allocator<U>& other) : c(other.c) {}
+
+    auto allocate(std::size_t n) -> T* {
+        ++this->c->allocated;
+        return std::allocator<T>().allocate(n);
+    }
+    auto deallocate(T* p, std::size_t n) -> void {
+        ++this->c->deallocated;
+        std::allocator<T>().deallocate(p, n);
+    }
+    template <typename U>
+    auto operator==(const counting_allocator<U>& other) const -> bool {
+        return this->c == other.c;
+    }
+};
+
+struct allocator_env {
+    counts* c;
+    auto    query(const test_std::get_allocator_t&) const noexcept -> counting_allocator<std::byte> {
+        return counting_allocator<std::byte>(this->c);
+    }
+};
+
+struct allocator_receiver {
+    using receiver_concept = test_std::receiver_t;
+    bool&   done;
+    counts* c;
+
+    auto set_value() && noexcept -> void { this->done = true; }
+    auto set_error(const std::exception_ptr&) && noexcept -> void {}
+    auto set_stopped() && noexcept -> void {}
+    auto get_env() const noexcept -> allocator_env { return {this->c}; }
+};
+
 auto test_connect_awaitable_promise() -> void {
     using connect_awaitable_promise = test_detail::operation_state_task<receiver>::promise_type;
 
@@ -293,6 +342,52 @@ auto test_connect_awaitable() -> void {
     }
 }
 
+auto test_connect_awaitable_frame() -> void {
+    struct void_awaiter {
+        ::std::coroutine_handle<>& handle;
+
+        auto await_ready() -> bool { return {}; }
+        auto await_suspend(::std::coroutine_handle<> h) -> void { this->handle = h; }
+        auto await_resume() -> void {}
+    };
+    struct plain_receiver {
+        using receiver_concept = test_std::receiver_t;
+        bool& done;
+        auto  set_value() && noexcept -> void { this->done = true; }
+        auto  set_error(const std::exception_ptr&) && noexcept -> void {}
+        auto  set_stopped() && noexcept -> void {}
+    };
+
+    ::std::coroutine_handle<> handle{};
+    bool                      done{};
+    void*                     frame{};
+    {
+        auto op{test_detail::connect_awaitable(void_awaiter{handle}, plain_receiver{done})};
+        frame = op.handle.address();
+    }
+    {
+        // the frame released above is recycled
+        auto op{test_detail::connect_awaitable(void_awaiter{handle}, plain_receiver{done})};
+        ASSERT(frame == op.handle.address());
+        op.start();
+        handle.resume();
+        ASSERT(done);
+    }
+
+    counts c{};
+    done = false;
+    {
+        auto op{test_detail::connect_awaitable(void_awaiter{handle}, allocator_receiver{done, &c})};
+        ASSERT(c.allocated == 1u);
+        ASSERT(c.deallocated == 0u);
+        op.start();
+        handle.resume();
+        ASSERT(done);
+    }
+    ASSERT(c.allocated == 1u);
+    ASSERT(c.deallocated == 1u);
+}
+
 auto test_connect_with_awaiter() -> void {
     struct local_awaiter {
         ::std::coroutine_handle<>& handle;
@@ -363,5 +458,6 @@ TEST(exec_connect) {
     test_operation_state_task();
     test_suspend_complete();
     test_connect_awaitable();
+    test_connect_awaitable_frame();
     test_connect_with_awaiter();
 }
@@ -0,0 +1,132 @@
+// tests/beman/execution/exec-counting-semaphore.test.cpp           -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <beman/execution/detail/counting_semaphore.hpp>
+#include <beman/execution/detail/connect.hpp>
+#include <beman/execution/detail/emplace_from.hpp>
+#include <beman/execution/detail/get_stop_token.hpp>
+#include <beman/execution/detail/receiver.hpp>
+#include <beman/execution/detail/sender.hpp>
+#include <beman/execution/detail/start.hpp>
+#include <beman/execution/detail/stop_source.hpp>
+#include <test/execution.hpp>
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <thread>
+
+// ----------------------------------------------------------------------------
+
+namespace {
+struct env {
+    test_std::stop_token token;
+    auto                 query(const test_std::get_stop_token_t&) const noexcept -> test_std::stop_token {
+        return this->token;
+    }
+};
+
+struct receiver {
+    using receiver_concept = test_std::receiver_t;
+    std::string*         log;
+    char                 id;
+    test_std::stop_token token{};
+
+    auto set_value() && noexcept -> void { *this->log += this->id; }
+    auto set_stopped() && noexcept -> void { *this->log += '-'; }
+    auto get_env() const noexcept -> env { return {this->token}; }
+};
+
+auto test_acquire_release() -> void {
+    test_std::counting_semaphore sem(2);
+    static_assert(test_std::sender<decltype(sem.acquire())>);
+    std::string log;
+    auto        op0{test_std::connect(sem.acquire(), receiver{&log, 'a'})};
+    auto        op1{test_std::connect(sem.acquire(), receiver{&log, 'b'})};
+    auto        op2{test_std::connect(sem.acquire(), receiver{&log, 'c'})};
+    auto        op3{test_std::connect(sem.acquire(), receiver{&log, 'd'})};
+    test_std::start(op0);
+    test_std::start(op1);
+    ASSERT(log == "ab");
+    test_std::start(op2);
+    test_std::start(op3);
+    ASSERT(log == "ab");
+    ASSERT(not sem.try_acquire());
+    sem.release(3);
+    ASSERT(log == "abcd");
+    ASSERT(sem.try_acquire());
+    ASSERT(not sem.try_acquire());
+}
+
+auto test_cancel() -> void {
+    test_std::counting_semaphore sem;
+    test_std::stop_source        source;
+    std::string                  log;
+    auto                         op0{test_std::connect(sem.acquire(), receiver{&log, 'a'})};
+    auto                         op1{test_std::connect(sem.acquire(), receiver{&log, 'b', source.get_token()})};
+    auto                         op2{test_std::connect(sem.acquire(), receiver{&log, 'c'})};
+    test_std::start(op0);
+    test_std::start(op1);
+    test_std::start(op2);
+    source.request_stop();
+    ASSERT(log == "-");
+    sem.release(2);
+    ASSERT(log == "-ac");
+    ASSERT(not sem.try_acquire());
+}
+
+auto test_fifo() -> void {
+    test_std::counting_semaphore sem;
+    std::string                  log;
+    auto                         op0{test_std::connect(sem.acquire(), receiver{&log, 'a'})};
+    auto                         op1{test_std::connect(sem.acquire(), receiver{&log, 'b'})};
+    test_std::start(op0);
+    sem.release(1);
+    ASSERT(log == "a");
+    // Once there are waiters neither try_acquire() nor acquire() can take a unit first.
+    auto op2{test_std::connect(sem.acquire(), receiver{&log, 'c'})};
+    auto op3{test_std::connect(sem.acquire(), receiver{&log, 'd'})};
+    test_std::start(op1);
+    test_std::start(op2);
+    ASSERT(not sem.try_acquire());
+    sem.release(1);
+    ASSERT(log == "ab");
+    test_std::start(op3);
+    sem.release(2);
+    ASSERT(log == "abcd");
+    ASSERT(not sem.try_acquire());
+}
+
+auto test_no_barging() -> void {
+    // A thread repeatedly trying to acquire must never take a unit released for an older waiter.
+    test_std::counting_semaphore sem;
+    std::atomic<bool>            done{};
+    std::atomic<int>             stolen{};
+    std::thread                  barger([&] {
+        while (not done) {
+            if (sem.try_acquire()) {
+                ++stolen;
+                sem.release(1);
+            }
+        }
+    });
+    std::string log;
+    for (int i{}; i != 100000; ++i) {
+        std::optional<decltype(test_std::connect(sem.acquire(), receiver{&log, 'a'}))> op;
+        op.emplace(test_detail::emplace_from{[&] { return test_std::connect(sem.acquire(), receiver{&log, 'a'}); }});
+        test_std::start(*op);
+        sem.release(1);
+        ASSERT(log.size() == std::size_t(i + 1));
+    }
+    done = true;
+    barger.join();
+    ASSERT(stolen == 0);
+}
+} // namespace
+
+TEST(exec_counting_semaphore) {
+    test_acquire_release();
+    test_cancel();
+    test_fifo();
+    test_no_barging();
+}
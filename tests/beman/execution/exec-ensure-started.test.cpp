@@ -0,0 +1,216 @@
+// tests/beman/execution/exec-ensure-started.test.cpp               -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <beman/execution/detail/ensure_started.hpp>
+#include <beman/execution/detail/connect.hpp>
+#include <beman/execution/detail/get_allocator.hpp>
+#include <beman/execution/detail/get_completion_signatures.hpp>
+#include <beman/execution/detail/get_stop_token.hpp>
+#include <beman/execution/detail/just.hpp>
+#include <beman/execution/detail/prop.hpp>
+#include <beman/execution/detail/receiver.hpp>
+#include <beman/execution/detail/sender.hpp>
+#include <beman/execution/detail/start.hpp>
+#include <beman/execution/detail/then.hpp>
+#include <test/execution.hpp>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+// ----------------------------------------------------------------------------
+
+namespace {
+enum class completion : char { none, value, error, stopped };
+
+struct receiver {
+    using receiver_concept = test_std::receiver_t;
+    completion* comp;
+    int*        result;
+
+    auto set_value(int value) && noexcept -> void {
+        *this->comp   = completion::value;
+        *this->result = value;
+    }
+    auto set_error(std::exception_ptr) && noexcept -> void { *this->comp = completion::error; }
+    auto set_stopped() && noexcept -> void { *this->comp = completion::stopped; }
+};
+
+struct manual {
+    struct base {
+        virtual ~base()                       = default;
+        virtual auto complete(int) -> void    = 0;
+        virtual auto stop_requested() -> bool = 0;
+    };
+    base* pending{};
+    bool  started{};
+
+    auto complete(int value) -> void { std::exchange(this->pending, nullptr)->complete(value); }
+};
+
+struct manual_sender {
+    using sender_concept        = test_std::sender_t;
+    using completion_signatures = test_std::completion_signatures<test_std::set_value_t(int)>;
+
+    template <typename Receiver>
+    struct state : manual::base {
+        using operation_state_concept = test_std::operation_state_t;
+        manual*  m;
+        Receiver receiver;
+
+        state(manual* mn, Receiver r) : m(mn), receiver(std::move(r)) {}
+        auto start() & noexcept -> void {
+            this->m->started = true;
+            this->m->pending = this;
+        }
+        auto complete(int value) -> void override { test_std::set_value(std::move(this->receiver), value); }
+        auto stop_requested() -> bool override {
+            return test_std::get_stop_token(test_std::get_env(this->receiver)).stop_requested();
+        }
+    };
+
+    manual* m;
+    template <typename Receiver>
+    auto connect(Receiver receiver) && -> state<Receiver> {
+        return {this->m, std::move(receiver)};
+    }
+};
+
+struct counts {
+    std::size_t allocated{};
+    std::size_t deallocated{};
+};
+
+template <typename T>
+struct allocator {
+    using value_type = T;
+    counts* c;
+
+    allocator(counts* cn) : c(cn) {}
+    template <typename U>
+    allocator(const allocator<U>& other) : c(other.c) {}
+
+    auto allocate(std::size_t n) -> T* {
+        ++this->c->allocated;
+        return std::allocator<T>().allocate(n);
+    }
+    auto deallocate(T* p, std::size_t n) -> void {
+        ++this->c->deallocated;
+        std::allocator<T>().deallocate(p, n);
+    }
+    template <typename U>
+    auto operator==(const allocator<U>& other) const -> bool {
+        return this->c == other.c;
+    }
+};
+
+auto test_ready() -> void {
+    completion comp{};
+    int        result{};
+    auto       sndr{test_std::just(17) | test_std::then([](int v) { return v + 25; }) | test_std::ensure_started};
+    static_assert(test_std::sender<decltype(sndr)>);
+    static_assert(not std::is_copy_constructible_v<decltype(sndr)>);
+    auto op{test_std::connect(std::move(sndr), receiver{&comp, &result})};
+    ASSERT(comp == completion::none);
+    test_std::start(op);
+    ASSERT(comp == completion::value);
+    ASSERT(result == 42);
+}
+
+auto test_eager() -> void {
+    manual     m;
+    completion comp{};
+    int        result{};
+    auto       sndr{test_std::ensure_started(manual_sender{&m})};
+    ASSERT(m.started);
+    auto op{test_std::connect(std::move(sndr), receiver{&comp, &result})};
+    test_std::start(op);
+    ASSERT(comp == completion::none);
+    m.complete(17);
+    ASSERT(comp == completion::value);
+    ASSERT(result == 17);
+
+    manual m0;
+    auto   sndr0{test_std::ensure_started(manual_sender{&m0})};
+    m0.complete(42);
+    auto op0{test_std::connect(std::move(sndr0), receiver{&comp, &result})};
+    test_std::start(op0);
+    ASSERT(result == 42);
+}
+
+auto test_abandon() -> void {
+    manual m;
+    {
+        auto sndr{test_std::ensure_started(manual_sender{&m})};
+        ASSERT(not m.pending->stop_requested());
+    }
+    ASSERT(m.pending->stop_requested());
+    m.complete(17);
+
+    {
+        auto sndr{test_std::ensure_started(test_std::just(17))};
+    }
+}
+
+auto test_allocator() -> void {
+    counts     c;
+    completion comp{};
+    int        result{};
+    {
+        auto sndr{test_std::ensure_started(test_std::just(17),
+                                           test_std::prop(test_std::get_allocator, allocator<std::byte>(&c)))};
+        ASSERT(c.allocated == 1u);
+        auto op{test_std::connect(std::move(sndr), receiver{&comp, &result})};
+        test_std::start(op);
+        ASSERT(result == 17);
+    }
+    ASSERT(c.allocated == 1u);
+    ASSERT(c.deallocated == 1u);
+}
+
+auto test_error() -> void {
+    completion comp{};
+    int        result{};
+    auto       op{test_std::connect(test_std::ensure_started(test_std::just_error(std::exception_ptr{}) |
+                                                       test_std::then([]() noexcept { return 0; })),
+                              receiver{&comp, &result})};
+    test_std::start(op);
+    ASSERT(comp == completion::error);
+}
+
+auto test_race() -> void {
+    for (int i{}; i != 1000; ++i) {
+        manual           m;
+        completion       comp{};
+        int              result{};
+        std::atomic<int> ready{};
+        auto             sndr{test_std::ensure_started(manual_sender{&m})};
+        std::thread      producer([&] {
+            ready.fetch_add(1);
+            while (ready.load() != 2) {
+            }
+            m.complete(i);
+        });
+        auto             op{test_std::connect(std::move(sndr), receiver{&comp, &result})};
+        ready.fetch_add(1);
+        while (ready.load() != 2) {
+        }
+        test_std::start(op);
+        producer.join();
+        ASSERT(comp == completion::value);
+        ASSERT(result == i);
+    }
+}
+} // namespace
+
+TEST(exec_ensure_started) {
+    test_ready();
+    test_eager();
+    test_abandon();
+    test_allocator();
+    test_error();
+    test_race();
+}
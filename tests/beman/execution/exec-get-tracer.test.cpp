@@ -0,0 +1,185 @@
+// tests/beman/execution/exec-get-tracer.test.cpp                   -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <beman/execution/detail/get_tracer.hpp>
+#include <beman/execution/detail/forwarding_query.hpp>
+#include <beman/execution/detail/connect.hpp>
+#include <beman/execution/detail/just.hpp>
+#include <beman/execution/detail/receiver.hpp>
+#include <beman/execution/detail/start.hpp>
+#include <beman/execution/detail/then.hpp>
+#include <beman/execution/detail/trace.hpp>
+#include <test/execution.hpp>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <exception>
+#include <vector>
+
+// ----------------------------------------------------------------------------
+
+namespace {
+enum class phase : unsigned char { start, complete };
+enum class algorithm : unsigned char { then, just, other };
+enum class completion : unsigned char { none, value, error, stopped };
+
+struct event {
+    phase                                 ph;
+    algorithm                             algo;
+    completion                            comp;
+    const void*                           op;
+    std::chrono::steady_clock::time_point time;
+};
+
+struct recorder {
+    std::vector<event> events;
+};
+
+template <typename Tag>
+constexpr auto algorithm_of() -> algorithm {
+    return std::same_as<Tag, test_std::then_t>   ? algorithm::then
+           : std::same_as<Tag, test_std::just_t> ? algorithm::just
+                                                 : algorithm::other;
+}
+
+struct tracer {
+    recorder* rec;
+
+    template <typename Tag>
+    auto on_start(Tag, const void* op, std::chrono::steady_clock::time_point time) const noexcept -> void {
+        this->rec->events.push_back({phase::start, algorithm_of<Tag>(), completion::none, op, time});
+    }
+    template <typename Tag, typename Completion>
+    auto on_complete(Tag, Completion, const void* op, std::chrono::steady_clock::time_point time) const noexcept
+        -> void {
+        completion comp{std::same_as<Completion, test_std::set_value_t>   ? completion::value
+                        : std::same_as<Completion, test_std::set_error_t> ? completion::error
+                                                                          : completion::stopped};
+        this->rec->events.push_back({phase::complete, algorithm_of<Tag>(), comp, op, time});
+    }
+};
+
+struct env {
+    recorder* rec;
+    auto      query(const test_std::get_tracer_t&) const noexcept -> tracer { return {this->rec}; }
+};
+
+struct receiver {
+    using receiver_concept = test_std::receiver_t;
+    recorder* rec;
+    int*      result;
+
+    auto set_value(int value) && noexcept -> void { *this->result = value; }
+    auto set_error(const std::exception_ptr&) && noexcept -> void { *this->result = -1; }
+    auto get_env() const noexcept -> env { return {this->rec}; }
+};
+
+struct untraced_receiver {
+    using receiver_concept = test_std::receiver_t;
+    int* result;
+
+    auto set_value(int value) && noexcept -> void { *this->result = value; }
+    auto set_error(const std::exception_ptr&) && noexcept -> void {}
+};
+
+auto test_get_tracer() -> void {
+    static_assert(std::same_as<const test_std::get_tracer_t, decltype(test_std::get_tracer)>);
+    static_assert(test_std::forwarding_query(test_std::get_tracer));
+    static_assert(not std::invocable<test_std::get_tracer_t, test_std::empty_env>);
+
+    recorder rec;
+    auto     t{test_std::get_tracer(env{&rec})};
+    static_assert(std::same_as<tracer, decltype(t)>);
+    ASSERT(t.rec == &rec);
+
+    static_assert(test_detail::traced_receiver<receiver>);
+    static_assert(not test_detail::traced_receiver<untraced_receiver>);
+    static_assert(test_detail::traced_receiver<test_detail::trace_receiver<test_std::then_t, receiver>>);
+    static_assert(std::same_as<untraced_receiver, test_detail::traced_receiver_t<test_std::then_t, untraced_receiver>>);
+}
+
+auto test_traced_leaf() -> void {
+    recorder rec;
+    int      result{};
+    auto     op{test_std::connect(test_std::just(17), receiver{&rec, &result})};
+    ASSERT(rec.events.empty());
+    test_std::start(op);
+    ASSERT(result == 17);
+
+    ASSERT(rec.events.size() == 2u);
+    ASSERT(rec.events[0].ph == phase::start);
+    ASSERT(rec.events[0].algo == algorithm::just);
+    ASSERT(rec.events[1].ph == phase::complete);
+    ASSERT(rec.events[1].algo == algorithm::just);
+    ASSERT(rec.events[1].comp == completion::value);
+    ASSERT(rec.events[0].op == rec.events[1].op);
+    ASSERT(rec.events[0].time <= rec.events[1].time);
+}
+
+auto test_traced_operation() -> void {
+    recorder rec;
+    int      result{};
+    auto     op{test_std::connect(test_std::then(test_std::just(17), [](int x) { return x + 2; }),
+                              receiver{&rec, &result})};
+    ASSERT(rec.events.empty());
+    test_std::start(op);
+    ASSERT(result == 19);
+
+    // The operations are properly nested: then starts just, just completes
+    // into then, and then delivers its own completion afterwards.
+    ASSERT(rec.events.size() == 4u);
+    ASSERT(rec.events[0].ph == phase::start);
+    ASSERT(rec.events[0].algo == algorithm::then);
+    ASSERT(rec.events[1].ph == phase::start);
+    ASSERT(rec.events[1].algo == algorithm::just);
+    ASSERT(rec.events[2].ph == phase::complete);
+    ASSERT(rec.events[2].algo == algorithm::just);
+    ASSERT(rec.events[2].comp == completion::value);
+    ASSERT(rec.events[3].ph == phase::complete);
+    ASSERT(rec.events[3].algo == algorithm::then);
+    ASSERT(rec.events[3].comp == completion::value);
+    ASSERT(rec.events[0].op == rec.events[3].op);
+    ASSERT(rec.events[1].op == rec.events[2].op);
+    ASSERT(rec.events[0].op != rec.events[1].op);
+    for (std::size_t i{1u}; i != rec.events.size(); ++i) {
+        ASSERT(rec.events[i - 1u].time <= rec.events[i].time);
+    }
+}
+
+auto test_traced_error() -> void {
+    recorder rec;
+    int      result{};
+    auto     op{test_std::connect(test_std::then(test_std::just(17),
+                                                 [](int x) -> int {
+                                                     if (x == 17)
+                                                         throw x;
+                                                     return x;
+                                                 }),
+                              receiver{&rec, &result})};
+    test_std::start(op);
+    ASSERT(result == -1);
+
+    ASSERT(rec.events.size() == 4u);
+    ASSERT(rec.events[2].algo == algorithm::just);
+    ASSERT(rec.events[2].comp == completion::value);
+    ASSERT(rec.events[3].algo == algorithm::then);
+    ASSERT(rec.events[3].comp == completion::error);
+    ASSERT(rec.events[0].op == rec.events[3].op);
+}
+
+auto test_untraced_operation() -> void {
+    int  result{};
+    auto op{test_std::connect(test_std::then(test_std::just(17), [](int x) { return x + 2; }),
+                              untraced_receiver{&result})};
+    test_std::start(op);
+    ASSERT(result == 19);
+}
+} // namespace
+
+TEST(exec_get_tracer) {
+    test_get_tracer();
+    test_traced_leaf();
+    test_traced_operation();
+    test_traced_error();
+    test_untraced_operation();
+}
@@ -0,0 +1,80 @@
+// tests/beman/execution/exec-module.test.cpp                       -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// This test deliberately doesn't use <test/execution.hpp>: it includes the
+// library headers which would hide whether the names come from the module.
+
+#undef NDEBUG
+#include <cassert>
+#include <concepts>
+#include <exception>
+#include <utility>
+
+import beman.execution;
+
+// ----------------------------------------------------------------------------
+
+namespace {
+namespace ex = beman::execution;
+
+struct receiver {
+    using receiver_concept = ex::receiver_t;
+    int* result;
+
+    auto set_value(int value) && noexcept -> void { *this->result = value; }
+    auto set_error(std::exception_ptr) && noexcept -> void { *this->result = -1; }
+    auto set_stopped() && noexcept -> void { *this->result = -2; }
+};
+
+auto test_pipeline() -> void {
+    auto sndr{ex::just(1) | ex::then([](int value) { return value + 1; }) |
+              ex::let_value([](int value) { return ex::just(value * 10); })};
+    static_assert(ex::sender<decltype(sndr)>);
+    static_assert(std::same_as<ex::completion_signatures<ex::set_value_t(int), ex::set_error_t(std::exception_ptr)>,
+                               ex::completion_signatures_of_t<decltype(sndr), ex::empty_env>>);
+
+    int  result{};
+    auto op{ex::connect(std::move(sndr), receiver{&result})};
+    ex::start(op);
+    assert(result == 20);
+}
+
+auto test_run_loop() -> void {
+    ex::run_loop loop;
+    int          result{};
+    auto         op{ex::connect(ex::schedule(loop.get_scheduler()) | ex::then([] { return 42; }), receiver{&result})};
+    ex::start(op);
+    assert(result == 0);
+    loop.finish();
+    loop.run();
+    assert(result == 42);
+}
+
+auto test_split() -> void {
+    auto sndr{ex::split(ex::just(17))};
+    static_assert(ex::sender<decltype(sndr)>);
+
+    int  result{};
+    auto op{ex::connect(sndr, receiver{&result})};
+    ex::start(op);
+    assert(result == 17);
+}
+
+auto test_stop_token() -> void {
+    ex::inplace_stop_source   source;
+    ex::inplace_stop_token    token{source.get_token()};
+    bool                      called{};
+    ex::inplace_stop_callback callback(token, [&called] { called = true; });
+    static_assert(ex::stoppable_token<ex::inplace_stop_token>);
+    assert(not called);
+    source.request_stop();
+    assert(called);
+}
+} // namespace
+
+auto main() -> int {
+    test_pipeline();
+    test_run_loop();
+    test_split();
+    test_stop_token();
+}
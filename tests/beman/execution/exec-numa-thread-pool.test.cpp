@@ -0,0 +1,151 @@
+// tests/beman/execution/exec-numa-thread-pool.test.cpp             -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <beman/execution/detail/numa_thread_pool.hpp>
+#include <beman/execution/detail/connect.hpp>
+#include <beman/execution/detail/connect_result_t.hpp>
+#include <beman/execution/detail/emplace_from.hpp>
+#include <beman/execution/detail/get_completion_scheduler.hpp>
+#include <beman/execution/detail/get_env.hpp>
+#include <beman/execution/detail/receiver.hpp>
+#include <beman/execution/detail/schedule.hpp>
+#include <beman/execution/detail/schedule_result_t.hpp>
+#include <beman/execution/detail/scheduler.hpp>
+#include <beman/execution/detail/start.hpp>
+#include <test/execution.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <list>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// ----------------------------------------------------------------------------
+
+namespace {
+struct receiver {
+    using receiver_concept = test_std::receiver_t;
+    test_std::numa_thread_pool* pool;
+    std::atomic<std::size_t>*   node;
+    std::atomic<int>*           done;
+
+    auto set_value() && noexcept -> void {
+        this->node->store(this->pool->get_scheduler().node);
+        this->done->fetch_add(1);
+        this->done->notify_all();
+    }
+    auto set_stopped() && noexcept -> void {}
+};
+
+//! Receiver blocking its worker until `release` becomes true.
+struct blocking_receiver {
+    using receiver_concept = test_std::receiver_t;
+    std::atomic<int>*  blocked;
+    std::atomic<bool>* release;
+
+    auto set_value() && noexcept -> void {
+        this->blocked->fetch_add(1);
+        this->blocked->notify_all();
+        this->release->wait(false);
+    }
+    auto set_stopped() && noexcept -> void {}
+};
+
+template <typename Receiver>
+using op_t =
+    test_std::connect_result_t<test_std::schedule_result_t<test_std::numa_thread_pool::scheduler>, Receiver>;
+
+template <typename Receiver>
+auto start_on(std::list<std::optional<op_t<Receiver>>>& ops, test_std::numa_thread_pool::scheduler sched, Receiver r)
+    -> void {
+    auto& op{ops.emplace_back()};
+    op.emplace(test_detail::emplace_from([&] { return test_std::connect(test_std::schedule(sched), r); }));
+    test_std::start(*op);
+}
+
+auto wait_for(std::atomic<int>& counter, int value) -> void {
+    for (int current{counter.load()}; current != value; current = counter.load())
+        counter.wait(current);
+}
+
+auto test_parse_cpu_list() -> void {
+    ASSERT(test_detail::numa_parse_cpu_list("0-3,8,10-11\n") == (std::vector<int>{0, 1, 2, 3, 8, 10, 11}));
+    ASSERT(test_detail::numa_parse_cpu_list("5") == (std::vector<int>{5}));
+    ASSERT(test_detail::numa_parse_cpu_list("") == (std::vector<int>{}));
+    ASSERT(test_detail::numa_parse_cpu_list("3-1,x,2") == (std::vector<int>{2}));
+}
+
+auto test_topology() -> void {
+    auto nodes{test_std::numa_thread_pool::topology()};
+    ASSERT(not nodes.empty());
+    for (const auto& node : nodes)
+        ASSERT(not node.cpus.empty());
+
+    std::atomic<std::size_t>                 node{};
+    std::atomic<int>                         done{};
+    std::list<std::optional<op_t<receiver>>> ops;
+    test_std::numa_thread_pool               pool;
+    ASSERT(pool.node_count() == nodes.size());
+    ASSERT(pool.node_count() <= pool.size());
+    start_on(ops, pool.get_scheduler(0u), receiver{&pool, &node, &done});
+    wait_for(done, 1);
+    ASSERT(node == 0u);
+}
+
+auto test_schedulers() -> void {
+    constexpr int                            count{1000};
+    std::atomic<std::size_t>                 nodes[2]{};
+    std::atomic<int>                         done{};
+    std::list<std::optional<op_t<receiver>>> ops;
+    test_std::numa_thread_pool pool({{0u, {0}}, {1u, {0}}}, 2u, test_std::numa_thread_pool::pinning::none);
+    ASSERT(pool.node_count() == 2u);
+    ASSERT(pool.size() == 4u);
+    ASSERT(pool.node(1u).id == 1u);
+
+    auto sched{pool.get_scheduler(1u)};
+    static_assert(test_std::scheduler<decltype(sched)>);
+    ASSERT(sched.node == 1u);
+    ASSERT(pool.get_scheduler().node == test_std::numa_thread_pool::any_node);
+    ASSERT(pool.get_scheduler(7u).node == test_std::numa_thread_pool::any_node);
+    ASSERT(sched != pool.get_scheduler(0u));
+    ASSERT(sched == test_std::get_completion_scheduler<test_std::set_value_t>(test_std::get_env(sched.schedule())));
+
+    for (int i{}; i != count; ++i)
+        start_on(ops, pool.get_scheduler(std::size_t(i % 2)), receiver{&pool, &nodes[i % 2], &done});
+    wait_for(done, count);
+    // work may be stolen across nodes but always runs on a worker knowing its node
+    ASSERT(nodes[0] < pool.node_count());
+    ASSERT(nodes[1] < pool.node_count());
+}
+
+auto test_steal() -> void {
+    std::atomic<int>                                  blocked{};
+    std::atomic<bool>                                 release{};
+    std::list<std::optional<op_t<blocking_receiver>>> blockers;
+    std::atomic<std::size_t>                          node{};
+    std::atomic<int>                                  done{};
+    std::list<std::optional<op_t<receiver>>>          ops;
+    test_std::numa_thread_pool pool({{0u, {0}}, {1u, {0}}}, 2u, test_std::numa_thread_pool::pinning::none);
+
+    // let the workers go idle such that only node 0 gets woken up for the blockers
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    for (int i{}; i != 2; ++i)
+        start_on(blockers, pool.get_scheduler(0u), blocking_receiver{&blocked, &release});
+    wait_for(blocked, 2);
+
+    start_on(ops, pool.get_scheduler(0u), receiver{&pool, &node, &done});
+    wait_for(done, 1);
+    ASSERT(node == 1u);
+    release = true;
+    release.notify_all();
+}
+} // namespace
+
+TEST(exec_numa_thread_pool) {
+    test_parse_cpu_list();
+    test_topology();
+    test_schedulers();
+    test_steal();
+}
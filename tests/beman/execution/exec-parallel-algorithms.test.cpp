@@ -0,0 +1,219 @@
+// tests/beman/execution/exec-parallel-algorithms.test.cpp          -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <beman/execution/detail/parallel_for_each.hpp>
+#include <beman/execution/detail/transform_reduce.hpp>
+#include <beman/execution/detail/inclusive_scan.hpp>
+#include <beman/execution/detail/inline_scheduler.hpp>
+#include <beman/execution/detail/numa_thread_pool.hpp>
+#include <beman/execution/detail/thread_context.hpp>
+#include <beman/execution/detail/connect.hpp>
+#include <beman/execution/detail/get_completion_signatures.hpp>
+#include <beman/execution/detail/get_stop_token.hpp>
+#include <beman/execution/detail/inplace_stop_source.hpp>
+#include <beman/execution/detail/just.hpp>
+#include <beman/execution/detail/let.hpp>
+#include <beman/execution/detail/receiver.hpp>
+#include <beman/execution/detail/sender.hpp>
+#include <beman/execution/detail/start.hpp>
+#include <beman/execution/detail/then.hpp>
+#include <test/execution.hpp>
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <numeric>
+#include <optional>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// ----------------------------------------------------------------------------
+
+namespace {
+struct env {
+    test_std::inplace_stop_token token;
+    auto                         query(const test_std::get_stop_token_t&) const noexcept { return this->token; }
+};
+
+enum class result { none, value, error, stopped };
+
+//! Receiver recording how it completed and the value it received, if any.
+template <typename T>
+struct receiver {
+    using receiver_concept = test_std::receiver_t;
+    std::optional<T>*            value;
+    std::atomic<result>*         done;
+    test_std::inplace_stop_token token{};
+
+    template <typename... A>
+    auto set_value(A&&... a) && noexcept -> void {
+        (this->value->emplace(std::forward<A>(a)), ...);
+        this->complete(result::value);
+    }
+    auto set_error(std::exception_ptr) && noexcept -> void { this->complete(result::error); }
+    auto set_stopped() && noexcept -> void { this->complete(result::stopped); }
+    auto get_env() const noexcept -> env { return {this->token}; }
+    auto complete(result r) -> void {
+        auto* d{this->done};
+        d->store(r);
+        d->notify_all();
+    }
+};
+
+struct nothing {};
+
+template <typename T, typename Sender>
+auto run(Sender&& sndr, std::optional<T>& value, test_std::inplace_stop_token token = {}) -> result {
+    std::atomic<result> done{result::none};
+    auto                op{test_std::connect(std::forward<Sender>(sndr), receiver<T>{&value, &done, token})};
+    test_std::start(op);
+    done.wait(result::none);
+    return done.load();
+}
+
+template <typename Scheduler>
+auto test_for_each(Scheduler sched) -> void {
+    std::vector<int> values(100000);
+    std::iota(values.begin(), values.end(), 0);
+    std::vector<int>       squares(values.size());
+    std::optional<nothing> value;
+    auto                   sndr{test_std::parallel_for_each(
+        sched, values, [&](const int& v) { squares[std::size_t(&v - values.data())] = v * 2; })};
+    static_assert(test_std::sender<decltype(sndr)>);
+    static_assert(std::same_as<test_std::completion_signatures<test_std::set_value_t(),
+                                                               test_std::set_error_t(std::exception_ptr),
+                                                               test_std::set_stopped_t()>,
+                               decltype(test_std::get_completion_signatures(sndr, env{}))>);
+    ASSERT(run(std::move(sndr), value) == result::value);
+    for (std::size_t i{}; i != values.size(); ++i)
+        ASSERT(squares[i] == values[i] * 2);
+
+    // modifying the elements in place of a non-contiguous range
+    std::optional<nothing> other;
+    std::vector<int>       out(1000);
+    ASSERT(run(test_std::parallel_for_each(
+                   sched, std::views::iota(0, 1000), [&](int i) { out[std::size_t(i)] = i + 1; }),
+               other) == result::value);
+    for (std::size_t i{}; i != out.size(); ++i)
+        ASSERT(out[i] == int(i) + 1);
+}
+
+template <typename Scheduler>
+auto test_transform_reduce(Scheduler sched) -> void {
+    std::vector<std::int64_t> values(100000);
+    std::iota(values.begin(), values.end(), 1);
+    std::optional<std::int64_t> value;
+    auto                        sndr{test_std::transform_reduce(
+        sched, values, std::int64_t(7), std::plus<>(), [](std::int64_t v) { return v * v; })};
+    static_assert(std::same_as<test_std::completion_signatures<test_std::set_value_t(std::int64_t),
+                                                               test_std::set_error_t(std::exception_ptr),
+                                                               test_std::set_stopped_t()>,
+                               decltype(test_std::get_completion_signatures(sndr, env{}))>);
+    ASSERT(run(std::move(sndr), value) == result::value);
+    std::int64_t expect{std::transform_reduce(
+        values.begin(), values.end(), std::int64_t(7), std::plus<>(), [](std::int64_t v) { return v * v; })};
+    ASSERT(value && *value == expect);
+
+    // an empty range yields init
+    std::vector<std::int64_t>   none;
+    std::optional<std::int64_t> empty;
+    ASSERT(run(test_std::transform_reduce(sched, none, std::int64_t(3), std::plus<>(), std::identity()), empty) ==
+           result::value);
+    ASSERT(empty && *empty == 3);
+
+    // the result composes with then
+    std::optional<bool> even;
+    ASSERT(run(test_std::transform_reduce(sched, values, std::int64_t(), std::plus<>(), std::identity()) |
+                   test_std::then([](std::int64_t sum) { return sum % 2 == 0; }),
+               even) == result::value);
+    ASSERT(even && *even == (100000ll * 100001ll / 2 % 2 == 0));
+}
+
+template <typename Scheduler>
+auto test_inclusive_scan(Scheduler sched) -> void {
+    for (std::size_t size : {0u, 1u, 1000u, 5000u, 100000u}) {
+        std::vector<std::int64_t> values(size);
+        std::iota(values.begin(), values.end(), 1);
+        std::vector<std::int64_t> out(size, -1);
+        std::optional<std::vector<std::int64_t>::iterator> value;
+        ASSERT(run(test_std::inclusive_scan(sched, values, out.begin()), value) == result::value);
+        ASSERT(value && *value == out.end());
+        std::vector<std::int64_t> expect(size);
+        std::inclusive_scan(values.begin(), values.end(), expect.begin());
+        ASSERT(out == expect);
+    }
+
+    // a non-additive associative operation
+    std::vector<std::int64_t> values(10000);
+    for (std::size_t i{}; i != values.size(); ++i)
+        values[i] = std::int64_t(i * 7919u % 10007u);
+    std::vector<std::int64_t>    out(values.size());
+    std::optional<std::int64_t*> value;
+    auto                         max{[](std::int64_t a, std::int64_t b) { return std::max(a, b); }};
+    ASSERT(run(test_std::inclusive_scan(sched, values, out.data(), max), value) == result::value);
+    ASSERT(value && *value == out.data() + out.size());
+    std::vector<std::int64_t> expect(values.size());
+    std::inclusive_scan(values.begin(), values.end(), expect.begin(), max);
+    ASSERT(out == expect);
+}
+
+template <typename Scheduler>
+auto test_errors(Scheduler sched) -> void {
+    std::vector<int>       values(100000, 1);
+    std::optional<nothing> value;
+    auto                   fail{[](int& v) {
+        if (v == 1)
+            throw std::runtime_error("chunk");
+    }};
+    ASSERT(run(test_std::parallel_for_each(sched, values, fail), value) == result::error);
+
+    std::optional<int> sum;
+    auto               transform{[](int v) {
+        if (v == 1)
+            throw 17;
+        return v;
+    }};
+    // the error of the chunks propagates through let_value
+    auto               reduce{[&] { return test_std::transform_reduce(sched, values, 0, std::plus<>(), transform); }};
+    ASSERT(run(test_std::let_value(test_std::just(), reduce), sum) == result::error);
+    ASSERT(not sum);
+}
+
+auto test_stopped() -> void {
+    std::vector<int>              values(100000, 1);
+    std::optional<int>            sum;
+    test_std::inplace_stop_source source;
+    source.request_stop();
+    test_std::thread_context context;
+    ASSERT(run(test_std::transform_reduce(context.get_scheduler(), values, 0, std::plus<>(), std::identity()),
+               sum,
+               source.get_token()) == result::stopped);
+    ASSERT(not sum);
+}
+
+template <typename Scheduler>
+auto test_all(Scheduler sched) -> void {
+    test_for_each(sched);
+    test_transform_reduce(sched);
+    test_inclusive_scan(sched);
+    test_errors(sched);
+}
+} // namespace
+
+TEST(exec_parallel_algorithms) {
+    test_all(test_std::inline_scheduler{});
+    {
+        test_std::thread_context context;
+        test_all(context.get_scheduler());
+    }
+    {
+        test_std::numa_thread_pool pool;
+        test_all(pool.get_scheduler());
+    }
+    test_stopped();
+}
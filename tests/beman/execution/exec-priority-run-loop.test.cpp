@@ -0,0 +1,125 @@
+// tests/beman/execution/exec-priority-run-loop.test.cpp            -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <beman/execution/detail/priority_run_loop.hpp>
+#include <beman/execution/detail/get_priority.hpp>
+#include <beman/execution/detail/connect.hpp>
+#include <beman/execution/detail/forwarding_query.hpp>
+#include <beman/execution/detail/get_completion_scheduler.hpp>
+#include <beman/execution/detail/receiver.hpp>
+#include <beman/execution/detail/schedule.hpp>
+#include <beman/execution/detail/scheduler.hpp>
+#include <beman/execution/detail/start.hpp>
+#include <test/execution.hpp>
+#include <concepts>
+#include <exception>
+#include <string>
+
+// ----------------------------------------------------------------------------
+
+namespace {
+struct receiver {
+    using receiver_concept = test_std::receiver_t;
+    std::string* order;
+    char         id;
+
+    auto set_value() && noexcept -> void { *this->order += this->id; }
+    auto set_error(const std::exception_ptr&) && noexcept -> void {}
+    auto set_stopped() && noexcept -> void {}
+};
+
+struct priority_env {
+    test_std::priority prio;
+    auto               query(const test_std::get_priority_t&) const noexcept { return this->prio; }
+};
+
+struct priority_receiver {
+    using receiver_concept = test_std::receiver_t;
+    std::string*       order;
+    char               id;
+    test_std::priority prio;
+
+    auto set_value() && noexcept -> void { *this->order += this->id; }
+    auto set_error(const std::exception_ptr&) && noexcept -> void {}
+    auto set_stopped() && noexcept -> void {}
+    auto get_env() const noexcept -> priority_env { return {this->prio}; }
+};
+
+struct finish_receiver {
+    using receiver_concept = test_std::receiver_t;
+    test_std::priority_run_loop* loop;
+
+    auto set_value() && noexcept -> void { this->loop->finish(); }
+    auto set_error(const std::exception_ptr&) && noexcept -> void {}
+    auto set_stopped() && noexcept -> void {}
+};
+
+auto test_get_priority() -> void {
+    static_assert(std::same_as<const test_std::get_priority_t, decltype(test_std::get_priority)>);
+    static_assert(test_std::forwarding_query(test_std::get_priority));
+    static_assert(not std::invocable<test_std::get_priority_t, test_std::empty_env>);
+    ASSERT(test_std::get_priority(priority_env{test_std::priority::low}) == test_std::priority::low);
+}
+
+auto test_scheduler() -> void {
+    test_std::priority_run_loop loop;
+    auto                        sched{loop.get_scheduler()};
+    static_assert(test_std::scheduler<decltype(sched)>);
+    ASSERT(sched == loop.get_scheduler(test_std::priority::normal));
+    ASSERT(sched != loop.get_scheduler(test_std::priority::high));
+    ASSERT(loop.get_scheduler(test_std::priority::high) ==
+           test_std::get_completion_scheduler<test_std::set_value_t>(
+               test_std::get_env(test_std::schedule(loop.get_scheduler(test_std::priority::high)))));
+}
+
+auto test_lanes() -> void {
+    test_std::priority_run_loop loop;
+    std::string                 order;
+    auto                        sched{loop.get_scheduler()};
+
+    auto l1{test_std::connect(sched.schedule(test_std::priority::low), receiver{&order, 'l'})};
+    auto l2{test_std::connect(sched.schedule(test_std::priority::low), receiver{&order, 'L'})};
+    auto n1{test_std::connect(test_std::schedule(sched), receiver{&order, 'n'})};
+    auto h1{test_std::connect(test_std::schedule(sched), priority_receiver{&order, 'h', test_std::priority::high})};
+    auto h2{test_std::connect(loop.get_scheduler(test_std::priority::high).schedule(), receiver{&order, 'H'})};
+    auto fin{test_std::connect(sched.schedule(test_std::priority::low), finish_receiver{&loop})};
+
+    test_std::start(l1);
+    test_std::start(l2);
+    test_std::start(n1);
+    test_std::start(h1);
+    test_std::start(h2);
+    test_std::start(fin);
+    loop.run();
+    ASSERT(order == "hHnlL");
+}
+
+auto test_starvation() -> void {
+    test_std::priority_run_loop loop(2u);
+    std::string                 order;
+    auto                        sched{loop.get_scheduler(test_std::priority::high)};
+
+    auto l{test_std::connect(sched.schedule(test_std::priority::low), receiver{&order, 'l'})};
+    auto h1{test_std::connect(test_std::schedule(sched), receiver{&order, '1'})};
+    auto h2{test_std::connect(test_std::schedule(sched), receiver{&order, '2'})};
+    auto h3{test_std::connect(test_std::schedule(sched), receiver{&order, '3'})};
+    auto h4{test_std::connect(test_std::schedule(sched), receiver{&order, '4'})};
+    auto fin{test_std::connect(test_std::schedule(sched), finish_receiver{&loop})};
+
+    test_std::start(l);
+    test_std::start(h1);
+    test_std::start(h2);
+    test_std::start(h3);
+    test_std::start(h4);
+    test_std::start(fin);
+    loop.run();
+    ASSERT(order == "12l34");
+}
+} // namespace
+
+TEST(exec_priority_run_loop) {
+    test_get_priority();
+    test_scheduler();
+    test_lanes();
+    test_starvation();
+}
@@ -0,0 +1,204 @@
+// tests/beman/execution/exec-repeat.test.cpp                       -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <beman/execution/detail/repeat.hpp>
+#include <beman/execution/detail/thread_context.hpp>
+#include <beman/execution/detail/connect.hpp>
+#include <beman/execution/detail/get_completion_signatures.hpp>
+#include <beman/execution/detail/get_stop_token.hpp>
+#include <beman/execution/detail/inplace_stop_source.hpp>
+#include <beman/execution/detail/just.hpp>
+#include <beman/execution/detail/receiver.hpp>
+#include <beman/execution/detail/schedule.hpp>
+#include <beman/execution/detail/sender.hpp>
+#include <beman/execution/detail/start.hpp>
+#include <beman/execution/detail/then.hpp>
+#include <test/execution.hpp>
+#include <atomic>
+#include <concepts>
+#include <exception>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+// ----------------------------------------------------------------------------
+
+namespace {
+struct env {
+    test_std::inplace_stop_token token;
+    auto                         query(const test_std::get_stop_token_t&) const noexcept { return this->token; }
+};
+
+enum class completion : char { none, value, error, stopped };
+
+struct receiver {
+    using receiver_concept = test_std::receiver_t;
+    std::atomic<completion>*     comp;
+    int*                         result{};
+    test_std::inplace_stop_token token{};
+    std::function<void()>*       destroy{};
+
+    auto set_value() && noexcept -> void { this->complete(completion::value); }
+    auto set_error(int value) && noexcept -> void {
+        *this->result = value;
+        this->complete(completion::error);
+    }
+    auto set_error(std::exception_ptr) && noexcept -> void { this->complete(completion::error); }
+    auto set_stopped() && noexcept -> void { this->complete(completion::stopped); }
+    auto get_env() const noexcept -> env { return {this->token}; }
+    auto complete(completion c) -> void {
+        std::atomic<completion>* cmp{this->comp};
+        if (this->destroy)
+            (*this->destroy)();
+        cmp->store(c);
+        cmp->notify_all();
+    }
+};
+
+//! Sender synchronously completing with the number of times it was started or failing with it once it reached `fail`.
+struct count_sender {
+    using sender_concept = test_std::sender_t;
+    using completion_signatures =
+        test_std::completion_signatures<test_std::set_value_t(int), test_std::set_error_t(int)>;
+
+    template <typename Receiver>
+    struct state {
+        using operation_state_concept = test_std::operation_state_t;
+        int*     count;
+        int      fail;
+        Receiver receiver;
+
+        auto start() & noexcept -> void {
+            int n{++*this->count};
+            if (n == this->fail)
+                test_std::set_error(std::move(this->receiver), n);
+            else
+                test_std::set_value(std::move(this->receiver), n);
+        }
+    };
+
+    int* count;
+    int  fail{-1};
+
+    template <typename Receiver>
+    auto connect(Receiver receiver) const& -> state<Receiver> {
+        return {this->count, this->fail, std::move(receiver)};
+    }
+};
+
+auto test_repeat_effect_until() -> void {
+    int                     count{};
+    std::atomic<completion> comp{};
+    auto sndr{test_std::repeat_effect_until(count_sender{&count}, [](int n) { return n == 100000; })};
+    static_assert(test_std::sender<decltype(sndr)>);
+    static_assert(std::same_as<test_std::completion_signatures<test_std::set_value_t(),
+                                                               test_std::set_error_t(int),
+                                                               test_std::set_error_t(std::exception_ptr),
+                                                               test_std::set_stopped_t()>,
+                               decltype(test_std::get_completion_signatures(sndr, env{}))>);
+    // synchronous iterations don't recurse
+    auto op{test_std::connect(std::move(sndr), receiver{&comp})};
+    test_std::start(op);
+    ASSERT(comp == completion::value);
+    ASSERT(count == 100000);
+
+    // errors of an iteration are passed on
+    int                     result{};
+    std::atomic<completion> comp0{};
+    count = 0;
+    auto op0{test_std::connect(count_sender{&count, 5} | test_std::repeat_effect_until([](int) { return false; }),
+                               receiver{&comp0, &result})};
+    test_std::start(op0);
+    ASSERT(comp0 == completion::error);
+    ASSERT(result == 5);
+
+    // exceptions from the predicate complete with set_error(exception_ptr)
+    std::atomic<completion> comp1{};
+    auto                    op1{test_std::connect(
+        test_std::repeat_effect_until(count_sender{&count}, [](int) -> bool { throw std::runtime_error("pred"); }),
+        receiver{&comp1, &result})};
+    test_std::start(op1);
+    ASSERT(comp1 == completion::error);
+}
+
+auto test_repeat_n() -> void {
+    int                     count{};
+    std::atomic<completion> comp{};
+    auto                    op{test_std::connect(test_std::repeat_n(count_sender{&count}, 7u), receiver{&comp})};
+    test_std::start(op);
+    ASSERT(comp == completion::value);
+    ASSERT(count == 7);
+
+    std::atomic<completion> comp0{};
+    auto                    op0{test_std::connect(count_sender{&count} | test_std::repeat_n(0u), receiver{&comp0})};
+    test_std::start(op0);
+    ASSERT(comp0 == completion::value);
+    ASSERT(count == 7);
+}
+
+auto test_scheduled() -> void {
+    std::atomic<int>        count{};
+    std::atomic<completion> comp{};
+    {
+        test_std::thread_context context;
+        auto                     sndr{test_std::schedule(context.get_scheduler()) |
+                  test_std::then([&count] { count.fetch_add(1, std::memory_order_relaxed); })};
+        auto                     op{test_std::connect(test_std::repeat_n(std::move(sndr), 1000u), receiver{&comp})};
+        test_std::start(op);
+        comp.wait(completion::none);
+    }
+    ASSERT(comp == completion::value);
+    ASSERT(count == 1000);
+}
+
+auto test_stopped() -> void {
+    test_std::inplace_stop_source source;
+    int                           count{};
+    std::atomic<completion>       comp{};
+    auto                          op{test_std::connect(
+        test_std::repeat_effect_until(count_sender{&count},
+                                      [&source](int n) {
+                                          if (n == 3)
+                                              source.request_stop();
+                                          return false;
+                                      }),
+        receiver{&comp, nullptr, source.get_token()})};
+    test_std::start(op);
+    ASSERT(comp == completion::stopped);
+    ASSERT(count == 3);
+}
+
+//! Runs sndr with a receiver destroying the operation state when it completes.
+template <typename Sender>
+auto run_destroying(Sender&& sndr, int* result = nullptr) -> completion {
+    std::atomic<completion> comp{};
+    std::function<void()>   destroy{};
+    auto* op{new auto(test_std::connect(std::forward<Sender>(sndr), receiver{&comp, result, {}, &destroy}))};
+    destroy = [op] { delete op; };
+    test_std::start(*op);
+    comp.wait(completion::none);
+    return comp;
+}
+
+auto test_destroy_on_completion() -> void {
+    ASSERT(run_destroying(test_std::repeat_n(test_std::just(), 3u)) == completion::value);
+
+    int count{};
+    int result{};
+    ASSERT(run_destroying(count_sender{&count, 5} | test_std::repeat_effect_until([](int) { return false; }),
+                          &result) == completion::error);
+    ASSERT(result == 5);
+
+    test_std::thread_context context;
+    ASSERT(run_destroying(test_std::repeat_n(test_std::schedule(context.get_scheduler()), 10u)) ==
+           completion::value);
+}
+} // namespace
+
+TEST(exec_repeat) {
+    test_repeat_effect_until();
+    test_repeat_n();
+    test_scheduled();
+    test_stopped();
+    test_destroy_on_completion();
+}
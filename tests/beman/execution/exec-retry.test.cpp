@@ -0,0 +1,234 @@
+// tests/beman/execution/exec-retry.test.cpp                        -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <beman/execution/detail/retry.hpp>
+#include <beman/execution/detail/timer_context.hpp>
+#include <beman/execution/detail/connect.hpp>
+#include <beman/execution/detail/get_completion_signatures.hpp>
+#include <beman/execution/detail/get_stop_token.hpp>
+#include <beman/execution/detail/inplace_stop_source.hpp>
+#include <beman/execution/detail/just.hpp>
+#include <beman/execution/detail/receiver.hpp>
+#include <beman/execution/detail/sender.hpp>
+#include <beman/execution/detail/start.hpp>
+#include <test/execution.hpp>
+#include <atomic>
+#include <chrono>
+#include <concepts>
+#include <exception>
+#include <functional>
+#include <optional>
+#include <utility>
+
+// ----------------------------------------------------------------------------
+
+namespace {
+using namespace std::chrono_literals;
+
+struct env {
+    test_std::inplace_stop_token token;
+    auto                         query(const test_std::get_stop_token_t&) const noexcept { return this->token; }
+};
+
+enum class completion : char { none, value, error, stopped };
+
+struct receiver {
+    using receiver_concept = test_std::receiver_t;
+    std::atomic<completion>*     comp;
+    int*                         result{};
+    test_std::inplace_stop_token token{};
+    std::function<void()>*       destroy{};
+
+    auto set_value() && noexcept -> void { this->complete(completion::value); }
+    auto set_value(int value) && noexcept -> void {
+        *this->result = value;
+        this->complete(completion::value);
+    }
+    auto set_error(int value) && noexcept -> void {
+        *this->result = value;
+        this->complete(completion::error);
+    }
+    auto set_error(std::exception_ptr) && noexcept -> void { this->complete(completion::error); }
+    auto set_stopped() && noexcept -> void { this->complete(completion::stopped); }
+    auto get_env() const noexcept -> env { return {this->token}; }
+    auto complete(completion c) -> void {
+        std::atomic<completion>* cmp{this->comp};
+        if (this->destroy)
+            (*this->destroy)();
+        cmp->store(c);
+        cmp->notify_all();
+    }
+};
+
+//! Sender failing synchronously with set_error(n) until it was started `failures` times.
+struct flaky_sender {
+    using sender_concept = test_std::sender_t;
+    using completion_signatures =
+        test_std::completion_signatures<test_std::set_value_t(int), test_std::set_error_t(int)>;
+
+    template <typename Receiver>
+    struct state {
+        using operation_state_concept = test_std::operation_state_t;
+        int*     attempts;
+        int      failures;
+        Receiver receiver;
+
+        auto start() & noexcept -> void {
+            int attempt{++*this->attempts};
+            if (attempt <= this->failures)
+                test_std::set_error(std::move(this->receiver), attempt);
+            else
+                test_std::set_value(std::move(this->receiver), attempt);
+        }
+    };
+
+    int* attempts;
+    int  failures;
+
+    template <typename Receiver>
+    auto connect(Receiver receiver) const& -> state<Receiver> {
+        return {this->attempts, this->failures, std::move(receiver)};
+    }
+};
+
+auto test_schedule_after() -> void {
+    test_std::timer_context context;
+    std::atomic<completion> comp{};
+    auto                    sndr{context.schedule_after(2ms)};
+    static_assert(test_std::sender<decltype(sndr)>);
+    auto start{test_std::timer_context::clock::now()};
+    auto op{test_std::connect(sndr, receiver{&comp})};
+    test_std::start(op);
+    comp.wait(completion::none);
+    ASSERT(comp == completion::value);
+    ASSERT(start + 2ms <= test_std::timer_context::clock::now());
+    ASSERT(context.size() == 0u);
+
+    test_std::inplace_stop_source source;
+    std::atomic<completion>       comp0{};
+    auto                          op0{
+        test_std::connect(context.schedule_after(1s), receiver{&comp0, nullptr, source.get_token()})};
+    test_std::start(op0);
+    ASSERT(context.size() == 1u);
+    source.request_stop();
+    ASSERT(comp0 == completion::stopped);
+    ASSERT(context.size() == 0u);
+}
+
+auto test_backoff() -> void {
+    test_std::exponential_backoff policy{4u, 10ms, 2.0, 30ms};
+    ASSERT(policy(1u) == std::optional(std::chrono::duration_cast<test_std::timer_context::duration>(10ms)));
+    ASSERT(policy(2u) == std::optional(std::chrono::duration_cast<test_std::timer_context::duration>(20ms)));
+    ASSERT(policy(3u) == std::optional(std::chrono::duration_cast<test_std::timer_context::duration>(30ms)));
+    ASSERT(policy(4u) == std::nullopt);
+}
+
+auto test_immediate() -> void {
+    auto no_delay{[](std::size_t n) -> std::optional<test_std::timer_context::duration> {
+        return n < 100000u ? std::optional(test_std::timer_context::duration()) : std::nullopt;
+    }};
+
+    int                     attempts{};
+    int                     result{};
+    std::atomic<completion> comp{};
+    auto                    sndr{test_std::retry(flaky_sender{&attempts, 50000}, no_delay)};
+    static_assert(test_std::sender<decltype(sndr)>);
+    static_assert(std::same_as<test_std::completion_signatures<test_std::set_value_t(int),
+                                                               test_std::set_error_t(int),
+                                                               test_std::set_error_t(std::exception_ptr),
+                                                               test_std::set_stopped_t()>,
+                               decltype(test_std::get_completion_signatures(sndr, env{}))>);
+    auto op{test_std::connect(std::move(sndr), receiver{&comp, &result})};
+    test_std::start(op);
+    ASSERT(comp == completion::value);
+    ASSERT(attempts == 50001);
+    ASSERT(result == 50001);
+
+    attempts = 0;
+    comp     = completion::none;
+    auto op0{test_std::connect(flaky_sender{&attempts, 10} | test_std::retry(test_std::exponential_backoff{3u, 0ms}),
+                               receiver{&comp, &result})};
+    test_std::start(op0);
+    ASSERT(comp == completion::error);
+    ASSERT(attempts == 3);
+    ASSERT(result == 3);
+}
+
+auto test_delayed() -> void {
+    test_std::timer_context context;
+    int                     attempts{};
+    int                     result{};
+    std::atomic<completion> comp{};
+    auto                    start{test_std::timer_context::clock::now()};
+    auto                    op{test_std::connect(
+        flaky_sender{&attempts, 2} | test_std::retry(context, test_std::exponential_backoff{5u, 2ms}),
+        receiver{&comp, &result})};
+    test_std::start(op);
+    comp.wait(completion::none);
+    ASSERT(comp == completion::value);
+    ASSERT(attempts == 3);
+    ASSERT(start + 6ms <= test_std::timer_context::clock::now());
+}
+
+auto test_stopped() -> void {
+    test_std::timer_context       context;
+    test_std::inplace_stop_source source;
+    int                           attempts{};
+    int                           result{};
+    std::atomic<completion>       comp{};
+    auto                          op{test_std::connect(
+        test_std::retry(flaky_sender{&attempts, 10}, context, test_std::exponential_backoff{5u, 1s}),
+        receiver{&comp, &result, source.get_token()})};
+    test_std::start(op);
+    ASSERT(attempts == 1);
+    ASSERT(context.size() == 1u);
+    source.request_stop();
+    ASSERT(comp == completion::stopped);
+    ASSERT(context.size() == 0u);
+
+    std::atomic<completion> comp0{};
+    auto op0{test_std::connect(test_std::retry(flaky_sender{&attempts, 10}, test_std::exponential_backoff{}),
+                               receiver{&comp0, &result, source.get_token()})};
+    test_std::start(op0);
+    ASSERT(comp0 == completion::stopped);
+    ASSERT(attempts == 1);
+}
+
+//! Runs sndr with a receiver destroying the operation state when it completes.
+template <typename Sender>
+auto run_destroying(Sender&& sndr, int& result) -> completion {
+    std::atomic<completion> comp{};
+    std::function<void()>   destroy{};
+    auto* op{new auto(test_std::connect(std::forward<Sender>(sndr), receiver{&comp, &result, {}, &destroy}))};
+    destroy = [op] { delete op; };
+    test_std::start(*op);
+    comp.wait(completion::none);
+    return comp;
+}
+
+auto test_destroy_on_completion() -> void {
+    test_std::timer_context context;
+    int                     attempts{};
+    int                     result{};
+
+    ASSERT(run_destroying(test_std::retry(test_std::just(1), test_std::exponential_backoff{}), result) ==
+           completion::value);
+    ASSERT(result == 1);
+    ASSERT(run_destroying(test_std::retry(flaky_sender{&attempts, 10}, test_std::exponential_backoff{3u, 0ms}),
+                          result) == completion::error);
+    ASSERT(result == 3);
+    attempts = 0;
+    ASSERT(run_destroying(test_std::retry(flaky_sender{&attempts, 1}, context, test_std::exponential_backoff{3u, 1ms}),
+                          result) == completion::value);
+    ASSERT(result == 2);
+}
+} // namespace
+
+TEST(exec_retry) {
+    test_schedule_after();
+    test_backoff();
+    test_immediate();
+    test_delayed();
+    test_stopped();
+    test_destroy_on_completion();
+}
@@ -0,0 +1,147 @@
+// tests/beman/execution/exec-run-loop-polling.test.cpp             -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <beman/execution/detail/run_loop.hpp>
+#include <beman/execution/detail/connect.hpp>
+#include <beman/execution/detail/connect_result_t.hpp>
+#include <beman/execution/detail/emplace_from.hpp>
+#include <beman/execution/detail/receiver.hpp>
+#include <beman/execution/detail/schedule.hpp>
+#include <beman/execution/detail/schedule_result_t.hpp>
+#include <beman/execution/detail/start.hpp>
+#include <test/execution.hpp>
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <list>
+#include <thread>
+#include <utility>
+
+// ----------------------------------------------------------------------------
+
+namespace {
+using scheduler_t = decltype(std::declval<test_std::run_loop&>().get_scheduler());
+
+//! Receiver counting its completions and optionally scheduling another operation.
+struct receiver {
+    using receiver_concept = test_std::receiver_t;
+    int*                       count;
+    void (*then)(receiver&){};
+    test_std::run_loop*        loop{};
+
+    auto set_value() && noexcept -> void {
+        ++*this->count;
+        if (this->then)
+            this->then(*this);
+    }
+    auto set_error(const std::exception_ptr&) && noexcept -> void {}
+    auto set_stopped() && noexcept -> void {}
+};
+
+using op_t = test_std::connect_result_t<test_std::schedule_result_t<scheduler_t>, receiver>;
+
+auto schedule(std::list<op_t>& ops, test_std::run_loop& loop, receiver rcvr) -> void {
+    ops.emplace_back(test_detail::emplace_from(
+        [&] { return test_std::connect(test_std::schedule(loop.get_scheduler()), std::move(rcvr)); }));
+    test_std::start(ops.back());
+}
+
+std::list<op_t>* more_ops{};
+
+auto test_poll() -> void {
+    std::list<op_t>    ops;
+    test_std::run_loop loop;
+    int                count{};
+
+    ASSERT(loop.poll() == 0u);
+    for (int i{}; i != 3; ++i)
+        schedule(ops, loop, receiver{&count});
+    ASSERT(loop.poll() == 3u);
+    ASSERT(count == 3);
+    ASSERT(loop.poll() == 0u);
+
+    // work scheduled by polled work is left for the next poll()
+    more_ops = &ops;
+    schedule(ops, loop, receiver{&count, [](receiver& r) { schedule(*more_ops, *r.loop, receiver{r.count}); }, &loop});
+    ASSERT(loop.poll() == 1u);
+    ASSERT(count == 4);
+    ASSERT(loop.poll() == 1u);
+    ASSERT(count == 5);
+}
+
+auto test_run_one() -> void {
+    std::list<op_t>    ops;
+    test_std::run_loop loop;
+    int                count{};
+
+    for (int i{}; i != 2; ++i)
+        schedule(ops, loop, receiver{&count});
+    ASSERT(loop.run_one() == 1u);
+    ASSERT(count == 1);
+    ASSERT(loop.run_one() == 1u);
+    ASSERT(count == 2);
+
+    loop.finish();
+    ASSERT(loop.run_one() == 0u);
+}
+
+auto test_run_for() -> void {
+    using namespace std::chrono_literals;
+    std::list<op_t>    ops;
+    test_std::run_loop loop;
+    int                count{};
+
+    auto start{std::chrono::steady_clock::now()};
+    ASSERT(loop.run_for(20ms) == 0u);
+    ASSERT(20ms <= std::chrono::steady_clock::now() - start);
+
+    for (int i{}; i != 3; ++i)
+        schedule(ops, loop, receiver{&count});
+    ASSERT(loop.run_for(10ms) == 3u);
+    ASSERT(count == 3);
+
+    // work scheduled from another thread wakes the waiting loop
+    std::thread producer([&] {
+        std::this_thread::sleep_for(10ms);
+        schedule(ops, loop, receiver{&count});
+    });
+    ASSERT(loop.run_one() == 1u);
+    producer.join();
+    ASSERT(count == 4);
+    start = std::chrono::steady_clock::now();
+    ASSERT(loop.run_until(start + 10ms) == 0u);
+
+    // after finish() the loop stops waiting
+    loop.finish();
+    start = std::chrono::steady_clock::now();
+    ASSERT(loop.run_for(10s) == 0u);
+    ASSERT(std::chrono::steady_clock::now() - start < 5s);
+}
+
+auto test_restart() -> void {
+    std::list<op_t>    ops;
+    test_std::run_loop loop;
+    int                count{};
+
+    schedule(ops, loop, receiver{&count});
+    loop.finish();
+    loop.run();
+    ASSERT(count == 1);
+
+    loop.restart();
+    schedule(ops, loop, receiver{&count});
+    schedule(ops, loop, receiver{&count, [](receiver& r) { r.loop->finish(); }, &loop});
+    loop.run();
+    ASSERT(count == 3);
+
+    loop.restart();
+    ASSERT(loop.poll() == 0u);
+}
+} // namespace
+
+TEST(exec_run_loop_polling) {
+    test_poll();
+    test_run_one();
+    test_run_for();
+    test_restart();
+}
@@ -0,0 +1,96 @@
+// tests/beman/execution/exec-run-loop-stats.test.cpp               -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <beman/execution/detail/run_loop_stats.hpp>
+#include <beman/execution/detail/run_loop.hpp>
+#include <beman/execution/detail/connect.hpp>
+#include <beman/execution/detail/receiver.hpp>
+#include <beman/execution/detail/schedule.hpp>
+#include <beman/execution/detail/start.hpp>
+#include <test/execution.hpp>
+#include <chrono>
+#include <concepts>
+#include <cstdint>
+#include <exception>
+#include <numeric>
+
+// ----------------------------------------------------------------------------
+
+namespace {
+struct receiver {
+    using receiver_concept = test_std::receiver_t;
+    int* count;
+
+    auto set_value() && noexcept -> void { ++*this->count; }
+    auto set_error(const std::exception_ptr&) && noexcept -> void {}
+    auto set_stopped() && noexcept -> void {}
+};
+
+struct finish_receiver {
+    using receiver_concept = test_std::receiver_t;
+    test_std::run_loop* loop;
+
+    auto set_value() && noexcept -> void { this->loop->finish(); }
+    auto set_error(const std::exception_ptr&) && noexcept -> void {}
+    auto set_stopped() && noexcept -> void {}
+};
+
+auto test_bucket() -> void {
+    using stats = test_std::run_loop_stats;
+    static_assert(stats::bucket(std::chrono::nanoseconds(-1)) == 0u);
+    static_assert(stats::bucket(std::chrono::nanoseconds(0)) == 0u);
+    static_assert(stats::bucket(std::chrono::nanoseconds(1)) == 1u);
+    static_assert(stats::bucket(std::chrono::nanoseconds(2)) == 2u);
+    static_assert(stats::bucket(std::chrono::nanoseconds(3)) == 2u);
+    static_assert(stats::bucket(std::chrono::nanoseconds(4)) == 3u);
+    static_assert(stats::bucket(std::chrono::hours(1000)) == stats::buckets - 1u);
+}
+
+auto test_initial() -> void {
+    test_std::run_loop_stats stats;
+    ASSERT(stats.enqueued() == 0u);
+    ASSERT(stats.dequeued() == 0u);
+    ASSERT(stats.depth() == 0u);
+    ASSERT(stats.max_depth() == 0u);
+    auto histogram{stats.delay_histogram()};
+    ASSERT(std::accumulate(histogram.begin(), histogram.end(), std::uint64_t{}) == 0u);
+}
+
+auto test_run_loop_stats() -> void {
+    test_std::run_loop_stats stats;
+    test_std::run_loop       loop(stats);
+    int                      count{};
+
+    auto sched{loop.get_scheduler()};
+    auto op0{test_std::connect(test_std::schedule(sched), receiver{&count})};
+    auto op1{test_std::connect(test_std::schedule(sched), receiver{&count})};
+    auto op2{test_std::connect(test_std::schedule(sched), receiver{&count})};
+    auto fin{test_std::connect(test_std::schedule(sched), finish_receiver{&loop})};
+
+    test_std::start(op0);
+    test_std::start(op1);
+    ASSERT(stats.enqueued() == 2u);
+    ASSERT(stats.depth() == 2u);
+    test_std::start(op2);
+    test_std::start(fin);
+    ASSERT(stats.enqueued() == 4u);
+    ASSERT(stats.dequeued() == 0u);
+    ASSERT(stats.depth() == 4u);
+    ASSERT(stats.max_depth() == 4u);
+
+    loop.run();
+    ASSERT(count == 3);
+    ASSERT(stats.enqueued() == 4u);
+    ASSERT(stats.dequeued() == 4u);
+    ASSERT(stats.depth() == 0u);
+    ASSERT(stats.max_depth() == 4u);
+    auto histogram{stats.delay_histogram()};
+    ASSERT(std::accumulate(histogram.begin(), histogram.end(), std::uint64_t{}) == 4u);
+}
+} // namespace
+
+TEST(exec_run_loop_stats) {
+    test_bucket();
+    test_initial();
+    test_run_loop_stats();
+}
@@ -5,6 +5,7 @@
 #include <beman/execution/execution.hpp>
 #include <test/execution.hpp>
 #include <concepts>
+#include <exception>
 
 // ----------------------------------------------------------------------------
 
@@ -53,6 +54,80 @@ struct sender {
     }
 };
 
+//! Scheduler counting how often work got scheduled on it.
+struct counting_scheduler {
+    struct env {
+        int* count;
+        auto query(const test_std::get_completion_scheduler_t<test_std::set_value_t>&) const noexcept
+            -> counting_scheduler {
+            return {this->count};
+        }
+    };
+    struct sender {
+        template <typename Receiver>
+        struct state {
+            using operation_state_concept = test_std::operation_state_t;
+            int*                          count;
+            std::remove_cvref_t<Receiver> receiver;
+            auto                          start() & noexcept -> void {
+                ++*this->count;
+                test_std::set_value(::std::move(this->receiver));
+            }
+        };
+        using sender_concept        = test_std::sender_t;
+        using completion_signatures = test_std::completion_signatures<test_std::set_value_t()>;
+        int* count;
+        auto get_env() const noexcept -> env { return {this->count}; }
+        template <test_std::receiver Receiver>
+        auto connect(Receiver&& receiver) -> state<Receiver> {
+            return {this->count, std::forward<Receiver>(receiver)};
+        }
+    };
+    using scheduler_concept = test_std::scheduler_t;
+    int* count;
+    auto schedule() -> sender { return {this->count}; }
+    auto operator==(const counting_scheduler&) const -> bool = default;
+};
+
+struct value_receiver {
+    using receiver_concept = test_std::receiver_t;
+    int* value;
+    auto set_value(int v) && noexcept -> void { *this->value = v; }
+    auto set_value() && noexcept -> void { *this->value = 0; }
+    auto set_error(const std::exception_ptr&) && noexcept -> void {}
+    auto set_stopped() && noexcept -> void {}
+};
+
+template <typename Sender>
+auto run(Sender&& sndr) -> int {
+    int  value{-1};
+    auto op{test_std::connect(std::forward<Sender>(sndr), value_receiver{&value})};
+    test_std::start(op);
+    return value;
+}
+
+auto test_hop_elision() -> void {
+    int                count_a{};
+    int                count_b{};
+    counting_scheduler a{&count_a};
+    counting_scheduler b{&count_b};
+
+    // the child already completes on the target scheduler: no hop
+    ASSERT(run(test_std::schedule_from(a, test_std::schedule(a))) == 0);
+    ASSERT(count_a == 1);
+    ASSERT(run(test_std::schedule_from(a, test_std::then(test_std::schedule(a), [] { return 17; }))) == 17);
+    ASSERT(count_a == 2);
+
+    // the child completes on a different scheduler of the same type: hop
+    ASSERT(run(test_std::schedule_from(b, test_std::schedule(a))) == 0);
+    ASSERT(count_a == 3);
+    ASSERT(count_b == 1);
+
+    // the child has no completion scheduler: hop
+    ASSERT(run(test_std::schedule_from(a, test_std::just(42))) == 42);
+    ASSERT(count_a == 4);
+}
+
 template <bool Expect, typename Scheduler, typename Sender>
 auto test_constraints(Scheduler&& scheduler, Sender&& sender) {
     static_assert(Expect == requires { test_std::schedule_from(scheduler, sender); });
@@ -83,4 +158,5 @@ TEST(exec_schedule_from) {
     test_constraints<true>(scheduler{}, sender{});
 
     test_use(scheduler{}, sender{});
+    test_hop_elision();
 }
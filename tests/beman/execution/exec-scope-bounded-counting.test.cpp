@@ -0,0 +1,229 @@
+// tests/beman/execution/exec-scope-bounded-counting.test.cpp       -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <beman/execution/detail/bounded_counting_scope.hpp>
+#include <beman/execution/detail/connect.hpp>
+#include <beman/execution/detail/get_completion_signatures.hpp>
+#include <beman/execution/detail/get_scheduler.hpp>
+#include <beman/execution/detail/get_stop_token.hpp>
+#include <beman/execution/detail/inline_scheduler.hpp>
+#include <beman/execution/detail/inplace_stop_source.hpp>
+#include <beman/execution/detail/receiver.hpp>
+#include <beman/execution/detail/scope_token.hpp>
+#include <beman/execution/detail/sender.hpp>
+#include <beman/execution/detail/set_value.hpp>
+#include <beman/execution/detail/spawn.hpp>
+#include <beman/execution/detail/start.hpp>
+#include <test/execution.hpp>
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// ----------------------------------------------------------------------------
+
+namespace {
+//! Sender whose operations only complete when completed explicitly via the list of running operations.
+struct manual_sender {
+    using sender_concept        = test_std::sender_t;
+    using completion_signatures = test_std::completion_signatures<test_std::set_value_t()>;
+
+    struct base {
+        virtual auto complete() -> void = 0;
+
+      protected:
+        ~base() = default;
+    };
+    template <test_std::receiver Receiver>
+    struct state : base {
+        using operation_state_concept = test_std::operation_state_t;
+        Receiver            receiver;
+        std::vector<base*>* running;
+
+        state(Receiver&& r, std::vector<base*>* ops) : receiver(std::move(r)), running(ops) {}
+        auto start() & noexcept -> void { this->running->push_back(this); }
+        auto complete() -> void override { test_std::set_value(std::move(this->receiver)); }
+    };
+
+    std::vector<base*>* running;
+
+    template <test_std::receiver Receiver>
+    auto connect(Receiver&& receiver) const -> state<std::remove_cvref_t<Receiver>> {
+        return {std::remove_cvref_t<Receiver>(std::forward<Receiver>(receiver)), this->running};
+    }
+};
+
+//! Sender completing synchronously when started, recording how many of its operations are nested.
+struct sync_sender {
+    using sender_concept        = test_std::sender_t;
+    using completion_signatures = test_std::completion_signatures<test_std::set_value_t()>;
+
+    struct depth {
+        std::size_t active{};
+        std::size_t max{};
+        std::size_t completed{};
+    };
+    template <test_std::receiver Receiver>
+    struct state {
+        using operation_state_concept = test_std::operation_state_t;
+        Receiver receiver;
+        depth*   dep;
+
+        auto start() & noexcept -> void {
+            depth* d{this->dep}; // the completion may destroy the operation state
+            d->max = std::max(d->max, ++d->active);
+            ++d->completed;
+            test_std::set_value(std::move(this->receiver));
+            --d->active;
+        }
+    };
+
+    depth* dep;
+
+    template <test_std::receiver Receiver>
+    auto connect(Receiver&& receiver) const -> state<std::remove_cvref_t<Receiver>> {
+        return {std::remove_cvref_t<Receiver>(std::forward<Receiver>(receiver)), this->dep};
+    }
+};
+
+auto complete_first(std::vector<manual_sender::base*>& running) -> void {
+    auto* op{running.front()};
+    running.erase(running.begin());
+    op->complete();
+}
+
+struct join_receiver {
+    using receiver_concept = test_std::receiver_t;
+    struct env {
+        auto query(const test_std::get_scheduler_t&) const noexcept -> test_std::inline_scheduler { return {}; }
+    };
+
+    bool* called;
+    auto  set_value() && noexcept -> void { *this->called = true; }
+    auto  get_env() const noexcept -> env { return {}; }
+};
+
+auto test_general() -> void {
+    using scope = test_std::bounded_counting_scope;
+    static_assert(test_std::scope_token<scope::token>);
+    static_assert(not std::is_move_constructible_v<scope>);
+    static_assert(not std::is_default_constructible_v<scope>);
+    static_assert(noexcept(scope(3u)));
+
+    scope sc(3u);
+    ASSERT(sc.max_concurrency() == 3u);
+    std::vector<manual_sender::base*> running;
+    auto                              sndr{sc.get_token().wrap(manual_sender{&running})};
+    static_assert(test_std::sender<decltype(sndr)>);
+    bool joined{};
+    auto join{test_std::connect(sc.join(), join_receiver{&joined})};
+    test_std::start(join);
+    ASSERT(joined);
+}
+
+auto test_limit() -> void {
+    std::vector<manual_sender::base*> running;
+    test_std::bounded_counting_scope  scope(3u);
+
+    for (int i{}; i != 10; ++i)
+        test_std::spawn(manual_sender{&running}, scope.get_token());
+    ASSERT(running.size() == 3u);
+
+    // completing one operation starts the next waiting one
+    complete_first(running);
+    ASSERT(running.size() == 3u);
+
+    bool joined{};
+    auto join{test_std::connect(scope.join(), join_receiver{&joined})};
+    test_std::start(join);
+    for (int completed{1}; completed != 10; ++completed) {
+        ASSERT(not joined);
+        ASSERT(running.size() == std::size_t(std::min(3, 10 - completed)));
+        complete_first(running);
+    }
+    ASSERT(running.empty());
+    ASSERT(joined);
+}
+
+auto test_no_recursion() -> void {
+    // Senders waiting for a slot which complete synchronously are started one after the other
+    // rather than each from within the completion of its predecessor.
+    std::vector<manual_sender::base*> running;
+    sync_sender::depth                dep;
+    test_std::bounded_counting_scope  scope(1u);
+
+    test_std::spawn(manual_sender{&running}, scope.get_token());
+    for (int i{}; i != 1000; ++i)
+        test_std::spawn(sync_sender{&dep}, scope.get_token());
+    ASSERT(running.size() == 1u);
+    ASSERT(dep.completed == 0u);
+
+    complete_first(running);
+    ASSERT(dep.completed == 1000u);
+    ASSERT(dep.max == 1u);
+
+    bool joined{};
+    auto join{test_std::connect(scope.join(), join_receiver{&joined})};
+    test_std::start(join);
+    ASSERT(joined);
+}
+
+//! Receiver of a wrapped sender recording the completion.
+struct stop_receiver {
+    using receiver_concept = test_std::receiver_t;
+    struct env {
+        test_std::inplace_stop_token token;
+        auto                         query(const test_std::get_stop_token_t&) const noexcept { return this->token; }
+    };
+
+    int*                         result;
+    test_std::inplace_stop_token token{};
+    auto                         set_value() && noexcept -> void { *this->result = 1; }
+    auto                         set_stopped() && noexcept -> void { *this->result = 2; }
+    auto                         get_env() const noexcept -> env { return {this->token}; }
+};
+
+auto test_stop() -> void {
+    std::vector<manual_sender::base*> running;
+    test_std::bounded_counting_scope  scope(1u);
+    auto                              token{scope.get_token()};
+
+    test_std::inplace_stop_source source;
+    int                           first{};
+    int                           second{};
+    ASSERT(token.try_associate());
+    ASSERT(token.try_associate());
+    auto op1{test_std::connect(token.wrap(manual_sender{&running}), stop_receiver{&first, source.get_token()})};
+    auto op2{test_std::connect(token.wrap(manual_sender{&running}), stop_receiver{&second, source.get_token()})};
+    test_std::start(op1);
+    test_std::start(op2);
+    ASSERT(running.size() == 1u);
+
+    // the waiting operation completes with set_stopped(), the running one continues
+    source.request_stop();
+    ASSERT(first == 0);
+    ASSERT(second == 2);
+    ASSERT(running.size() == 1u);
+    complete_first(running);
+    ASSERT(first == 1);
+    token.disassociate();
+    token.disassociate();
+
+    // the slot taken by the completed operation was released
+    int  third{};
+    auto op3{test_std::connect(token.wrap(manual_sender{&running}), stop_receiver{&third})};
+    test_std::start(op3);
+    ASSERT(running.size() == 1u);
+    complete_first(running);
+    ASSERT(third == 1);
+}
+} // namespace
+
+TEST(exec_scope_bounded_counting) {
+    test_general();
+    test_limit();
+    test_no_recursion();
+    test_stop();
+}
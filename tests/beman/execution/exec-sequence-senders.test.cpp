@@ -0,0 +1,276 @@
+// tests/beman/execution/exec-sequence-senders.test.cpp             -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <beman/execution/detail/completion_signatures.hpp>
+#include <beman/execution/detail/connect.hpp>
+#include <beman/execution/detail/filter_each.hpp>
+#include <beman/execution/detail/get_completion_signatures.hpp>
+#include <beman/execution/detail/get_stop_token.hpp>
+#include <beman/execution/detail/inplace_stop_source.hpp>
+#include <beman/execution/detail/item_types_of_t.hpp>
+#include <beman/execution/detail/iterate.hpp>
+#include <beman/execution/detail/just.hpp>
+#include <beman/execution/detail/receiver.hpp>
+#include <beman/execution/detail/reduce.hpp>
+#include <beman/execution/detail/sequence_sender.hpp>
+#include <beman/execution/detail/set_next.hpp>
+#include <beman/execution/detail/start.hpp>
+#include <beman/execution/detail/then.hpp>
+#include <beman/execution/detail/transform_each.hpp>
+#include <test/execution.hpp>
+#include <concepts>
+#include <cstddef>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+// ----------------------------------------------------------------------------
+
+namespace {
+struct env {
+    test_std::inplace_stop_token token;
+    auto                         query(const test_std::get_stop_token_t&) const noexcept { return this->token; }
+};
+
+enum class completion : char { none, value, error, stopped };
+
+template <typename T>
+struct value_receiver {
+    using receiver_concept = test_std::receiver_t;
+    completion*                  comp;
+    T*                           result;
+    test_std::inplace_stop_token token{};
+
+    auto set_value(T value) && noexcept -> void {
+        *this->comp   = completion::value;
+        *this->result = std::move(value);
+    }
+    auto set_error(std::exception_ptr) && noexcept -> void { *this->comp = completion::error; }
+    auto set_stopped() && noexcept -> void { *this->comp = completion::stopped; }
+    auto get_env() const noexcept -> env { return {this->token}; }
+};
+
+struct gate {
+    struct waiter {
+        virtual ~waiter()             = default;
+        virtual auto resume() -> void = 0;
+    };
+    std::vector<waiter*> waiting;
+
+    auto resume() -> void {
+        auto* w{this->waiting.front()};
+        this->waiting.erase(this->waiting.begin());
+        w->resume();
+    }
+};
+
+template <typename Receiver>
+struct gated_state : gate::waiter {
+    using operation_state_concept = test_std::operation_state_t;
+    gate*    g;
+    bool     stop;
+    Receiver receiver;
+
+    gated_state(gate* gt, bool s, Receiver r) : g(gt), stop(s), receiver(std::move(r)) {}
+    auto start() & noexcept -> void { this->g->waiting.push_back(this); }
+    auto resume() -> void override {
+        if (this->stop)
+            test_std::set_stopped(std::move(this->receiver));
+        else
+            test_std::set_value(std::move(this->receiver));
+    }
+};
+
+struct gated_sender {
+    using sender_concept        = test_std::sender_t;
+    using completion_signatures = test_std::completion_signatures<test_std::set_value_t(), test_std::set_stopped_t()>;
+    gate* g;
+    bool  stop;
+
+    template <typename Receiver>
+    auto connect(Receiver receiver) && -> gated_state<Receiver> {
+        return {this->g, this->stop, std::move(receiver)};
+    }
+};
+
+struct sequence_receiver {
+    using receiver_concept = test_std::receiver_t;
+    std::size_t*                 items;
+    completion*                  comp;
+    gate*                        g{};
+    std::size_t                  stop_after{~std::size_t{}};
+    test_std::inplace_stop_token token{};
+
+    template <typename Item>
+    auto set_next(Item&&) & -> gated_sender {
+        return {this->g, this->stop_after <= ++*this->items};
+    }
+    auto set_value() && noexcept -> void { *this->comp = completion::value; }
+    auto set_error(std::exception_ptr) && noexcept -> void { *this->comp = completion::error; }
+    auto set_stopped() && noexcept -> void { *this->comp = completion::stopped; }
+    auto get_env() const noexcept -> env { return {this->token}; }
+};
+
+struct recording_receiver {
+    using receiver_concept = test_std::receiver_t;
+    std::vector<int>* values;
+    completion*       comp;
+
+    template <typename Item>
+    auto set_next(Item&& item) & {
+        return test_std::then(std::forward<Item>(item),
+                              [values = this->values](int value) noexcept { values->push_back(value); });
+    }
+    auto set_value() && noexcept -> void { *this->comp = completion::value; }
+    auto set_error(std::exception_ptr) && noexcept -> void { *this->comp = completion::error; }
+    auto set_stopped() && noexcept -> void { *this->comp = completion::stopped; }
+};
+
+auto test_concepts() -> void {
+    std::vector<int> values{1, 2, 3};
+    auto             seq{test_std::iterate(values)};
+    static_assert(test_std::sender<decltype(seq)>);
+    static_assert(test_std::sequence_sender<decltype(seq)>);
+    static_assert(not test_std::sequence_sender<decltype(test_std::just(1))>);
+    static_assert(std::same_as<test_std::completion_signatures<test_std::set_value_t(int)>,
+                               test_std::item_types_of_t<decltype(seq)>>);
+
+    auto strings{seq | test_std::transform_each([](int v) noexcept { return std::to_string(v); })};
+    static_assert(test_std::sequence_sender<decltype(strings)>);
+    static_assert(std::same_as<test_std::completion_signatures<test_std::set_value_t(std::string)>,
+                               test_std::item_types_of_t<decltype(strings)>>);
+
+    auto filtered{seq | test_std::filter_each([](int v) { return v % 2 == 0; })};
+    static_assert(test_std::sequence_sender<decltype(filtered)>);
+
+    auto sum{test_std::reduce(seq, 0L, [](long acc, int v) { return acc + v; })};
+    static_assert(test_std::sender<decltype(sum)>);
+    static_assert(not test_std::sequence_sender<decltype(sum)>);
+    static_assert(std::same_as<test_std::completion_signatures<test_std::set_value_t(long),
+                                                               test_std::set_error_t(std::exception_ptr),
+                                                               test_std::set_stopped_t()>,
+                               decltype(test_std::get_completion_signatures(sum, test_std::empty_env{}))>);
+}
+
+auto test_reduce() -> void {
+    std::vector<int> values{1, 2, 3, 4};
+    completion       comp{};
+    long             result{};
+    auto op{test_std::connect(test_std::reduce(test_std::iterate(values), 0L, [](long acc, int v) { return acc + v; }),
+                              value_receiver<long>{&comp, &result})};
+    test_std::start(op);
+    ASSERT(comp == completion::value);
+    ASSERT(result == 10);
+
+    auto empty_op{test_std::connect(
+        test_std::reduce(test_std::iterate(std::vector<int>{}), 17L, [](long acc, int v) { return acc + v; }),
+        value_receiver<long>{&comp, &result})};
+    test_std::start(empty_op);
+    ASSERT(comp == completion::value);
+    ASSERT(result == 17);
+}
+
+auto test_pipeline() -> void {
+    completion  comp{};
+    std::string result{};
+    auto        sndr{test_std::iterate(std::vector<int>{1, 2, 3, 4, 5, 6}) |
+              test_std::transform_each([](int v) { return v * v; }) |
+              test_std::filter_each([](int v) { return v % 2 == 0; }) |
+              test_std::transform_each([](int v) { return std::to_string(v); }) |
+              test_std::reduce(std::string{}, [](std::string acc, std::string v) { return acc + "," + v; })};
+    auto        op{test_std::connect(std::move(sndr), value_receiver<std::string>{&comp, &result})};
+    test_std::start(op);
+    ASSERT(comp == completion::value);
+    ASSERT(result == ",4,16,36");
+}
+
+auto test_backpressure() -> void {
+    std::vector<int> values{1, 2, 3};
+    gate             g;
+    std::size_t      items{};
+    completion       comp{};
+    auto             op{test_std::connect(test_std::iterate(values), sequence_receiver{&items, &comp, &g})};
+    test_std::start(op);
+    ASSERT(items == 1u);
+    ASSERT(g.waiting.size() == 1u);
+    g.resume();
+    ASSERT(items == 2u);
+    g.resume();
+    ASSERT(items == 3u);
+    ASSERT(comp == completion::none);
+    g.resume();
+    ASSERT(comp == completion::value);
+    ASSERT(g.waiting.empty());
+}
+
+auto test_stop() -> void {
+    std::vector<int> values{1, 2, 3, 4};
+    std::vector<int> seen;
+    completion       comp{};
+    auto             op{test_std::connect(test_std::iterate(values), recording_receiver{&seen, &comp})};
+    test_std::start(op);
+    ASSERT(comp == completion::value);
+    ASSERT(seen == values);
+
+    gate        g0;
+    std::size_t items0{};
+    completion  comp0{};
+    auto        op0{test_std::connect(test_std::iterate(values), sequence_receiver{&items0, &comp0, &g0, 2u})};
+    test_std::start(op0);
+    g0.resume();
+    ASSERT(items0 == 2u);
+    g0.resume();
+    ASSERT(items0 == 2u);
+    ASSERT(comp0 == completion::stopped);
+
+    test_std::inplace_stop_source source;
+    gate                          g;
+    std::size_t                   items{};
+    completion                    comp1{};
+    auto                          op1{
+        test_std::connect(test_std::iterate(values), sequence_receiver{&items, &comp1, &g, 10u, source.get_token()})};
+    test_std::start(op1);
+    ASSERT(items == 1u);
+    source.request_stop();
+    g.resume();
+    ASSERT(items == 1u);
+    ASSERT(comp1 == completion::stopped);
+}
+
+auto test_errors() -> void {
+    std::vector<int> values{1, 2, 3};
+    completion       comp{};
+    long             result{};
+    auto             op{test_std::connect(test_std::reduce(test_std::iterate(values),
+                                               0L,
+                                               [](long acc, int v) {
+                                                   if (v == 2)
+                                                       throw std::runtime_error("reduce failed");
+                                                   return acc + v;
+                                               }),
+                                  value_receiver<long>{&comp, &result})};
+    test_std::start(op);
+    ASSERT(comp == completion::error);
+
+    completion comp1{};
+    auto       op1{test_std::connect(test_std::iterate(values) | test_std::filter_each([](int v) {
+                                   if (v == 3)
+                                       throw std::runtime_error("filter failed");
+                                   return true;
+                               }) | test_std::reduce(0L, [](long acc, int v) { return acc + v; }),
+                               value_receiver<long>{&comp1, &result})};
+    test_std::start(op1);
+    ASSERT(comp1 == completion::error);
+}
+} // namespace
+
+TEST(exec_sequence_senders) {
+    test_concepts();
+    test_reduce();
+    test_pipeline();
+    test_backpressure();
+    test_stop();
+    test_errors();
+}
@@ -0,0 +1,271 @@
+// tests/beman/execution/exec-strand.test.cpp                       -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <beman/execution/detail/strand.hpp>
+#include <beman/execution/detail/connect.hpp>
+#include <beman/execution/detail/connect_result_t.hpp>
+#include <beman/execution/detail/emplace_from.hpp>
+#include <beman/execution/detail/get_completion_scheduler.hpp>
+#include <beman/execution/detail/get_completion_signatures.hpp>
+#include <beman/execution/detail/inplace_stop_source.hpp>
+#include <beman/execution/detail/receiver.hpp>
+#include <beman/execution/detail/run_loop.hpp>
+#include <beman/execution/detail/schedule.hpp>
+#include <beman/execution/detail/schedule_result_t.hpp>
+#include <beman/execution/detail/scheduler.hpp>
+#include <beman/execution/detail/start.hpp>
+#include <test/execution.hpp>
+#include <test/inline_scheduler.hpp>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <optional>
+#include <thread>
+#include <vector>
+
+// ----------------------------------------------------------------------------
+
+namespace {
+struct order_receiver {
+    using receiver_concept = test_std::receiver_t;
+    std::vector<int>* order;
+    int               id;
+
+    auto set_value() && noexcept -> void { this->order->push_back(this->id); }
+    auto set_stopped() && noexcept -> void { this->order->push_back(-this->id); }
+};
+
+struct finish_receiver {
+    using receiver_concept = test_std::receiver_t;
+    test_std::run_loop* loop;
+
+    auto set_value() && noexcept -> void { this->loop->finish(); }
+    auto set_error(const std::exception_ptr&) && noexcept -> void { this->loop->finish(); }
+    auto set_stopped() && noexcept -> void { this->loop->finish(); }
+};
+
+struct shared_state {
+    std::atomic<bool> active{};
+    std::atomic<bool> overlap{};
+    std::size_t       count{};
+};
+
+struct count_receiver {
+    using receiver_concept = test_std::receiver_t;
+    shared_state* state;
+
+    auto set_value() && noexcept -> void {
+        if (this->state->active.exchange(true))
+            this->state->overlap = true;
+        ++this->state->count;
+        this->state->active = false;
+    }
+    auto set_stopped() && noexcept -> void {}
+};
+
+struct function_receiver {
+    using receiver_concept = test_std::receiver_t;
+    std::function<void()>* fun;
+
+    auto set_value() && noexcept -> void { (*this->fun)(); }
+    auto set_stopped() && noexcept -> void { (*this->fun)(); }
+};
+
+//! Scheduler completing on a run_loop which checks that its operation states outlive their completion.
+struct checked_scheduler {
+    using scheduler_concept = test_std::scheduler_t;
+    using loop_sender       = decltype(test_std::schedule(std::declval<test_std::run_loop&>().get_scheduler()));
+
+    template <typename Receiver>
+    struct state {
+        using operation_state_concept = test_std::operation_state_t;
+        struct loop_receiver {
+            using receiver_concept = test_std::receiver_t;
+            state* st;
+
+            auto set_value() && noexcept -> void { this->st->complete(); }
+            auto set_error(const std::exception_ptr&) && noexcept -> void { this->st->complete(); }
+            auto set_stopped() && noexcept -> void { this->st->complete(); }
+        };
+
+        Receiver                                                 receiver;
+        bool*                                                    alive{};
+        test_std::connect_result_t<loop_sender, loop_receiver> op;
+
+        state(test_std::run_loop* loop, Receiver r)
+            : receiver(std::move(r)),
+              op(test_std::connect(test_std::schedule(loop->get_scheduler()), loop_receiver{this})) {}
+        state(state&&) = delete;
+        ~state() {
+            if (this->alive)
+                *this->alive = false;
+        }
+        auto start() & noexcept -> void { test_std::start(this->op); }
+        auto complete() noexcept -> void {
+            bool alive{true};
+            this->alive = &alive;
+            test_std::set_value(std::move(this->receiver));
+            ASSERT(alive);
+            this->alive = nullptr;
+        }
+    };
+    struct env {
+        test_std::run_loop* loop;
+        auto query(const test_std::get_completion_scheduler_t<test_std::set_value_t>&) const noexcept {
+            return checked_scheduler{this->loop};
+        }
+    };
+    struct sender {
+        using sender_concept        = test_std::sender_t;
+        using completion_signatures = test_std::completion_signatures<test_std::set_value_t()>;
+        test_std::run_loop* loop;
+
+        auto get_env() const noexcept -> env { return {this->loop}; }
+        template <typename Receiver>
+        auto connect(Receiver receiver) const -> state<Receiver> {
+            return {this->loop, std::move(receiver)};
+        }
+    };
+
+    test_std::run_loop* loop;
+
+    auto schedule() const noexcept -> sender { return {this->loop}; }
+    auto operator==(const checked_scheduler&) const -> bool = default;
+};
+
+using inline_strand = test_std::strand<test::inline_scheduler>;
+using count_sender  = decltype(std::declval<inline_strand&>().get_scheduler().schedule());
+struct slot {
+    test_std::connect_result_t<count_sender, count_receiver> op;
+    slot(count_sender s, count_receiver r) : op(test_std::connect(s, r)) {}
+};
+
+struct token_env {
+    test_std::inplace_stop_token token;
+    auto                         query(const test_std::get_stop_token_t&) const noexcept { return this->token; }
+};
+
+struct stop_receiver {
+    using receiver_concept = test_std::receiver_t;
+    test_std::inplace_stop_token token;
+    bool*                        stopped;
+
+    auto set_value() && noexcept -> void {}
+    auto set_stopped() && noexcept -> void { *this->stopped = true; }
+    auto get_env() const noexcept -> token_env { return {this->token}; }
+};
+
+auto test_concepts() -> void {
+    test_std::strand<test::inline_scheduler> s1{test::inline_scheduler{}};
+    test_std::strand<test::inline_scheduler> s2{test::inline_scheduler{}};
+    static_assert(not std::move_constructible<test_std::strand<test::inline_scheduler>>);
+    static_assert(test_std::scheduler<decltype(s1.get_scheduler())>);
+    ASSERT(s1.get_scheduler() == s1.get_scheduler());
+    ASSERT(s1.get_scheduler() != s2.get_scheduler());
+
+    auto sndr{test_std::schedule(s1.get_scheduler())};
+    static_assert(std::same_as<test_std::completion_signatures<test_std::set_value_t(), test_std::set_stopped_t()>,
+                               decltype(test_std::get_completion_signatures(sndr, test_std::empty_env{}))>);
+    ASSERT(s1.get_scheduler() == test_std::get_completion_scheduler<test_std::set_value_t>(test_std::get_env(sndr)));
+}
+
+auto test_fifo_burst() -> void {
+    test_std::run_loop_stats stats;
+    test_std::run_loop       loop(stats);
+    test_std::strand         strand(loop.get_scheduler());
+    std::vector<int>         order;
+
+    auto op1{test_std::connect(test_std::schedule(strand.get_scheduler()), order_receiver{&order, 1})};
+    auto op2{test_std::connect(test_std::schedule(strand.get_scheduler()), order_receiver{&order, 2})};
+    auto op3{test_std::connect(test_std::schedule(strand.get_scheduler()), order_receiver{&order, 3})};
+    auto fin{test_std::connect(test_std::schedule(loop.get_scheduler()), finish_receiver{&loop})};
+    test_std::start(op1);
+    test_std::start(op2);
+    test_std::start(op3);
+    test_std::start(fin);
+    ASSERT(order.empty());
+    ASSERT(stats.enqueued() == 2u); // one drain for the strand plus the finish operation
+
+    loop.run();
+    ASSERT((order == std::vector<int>{1, 2, 3}));
+}
+
+auto test_destroy_in_completion() -> void {
+    test_std::run_loop                  loop;
+    test_std::strand<checked_scheduler> strand(checked_scheduler{&loop});
+    using sender_t = decltype(test_std::schedule(strand.get_scheduler()));
+    using op_t     = test_std::connect_result_t<sender_t, function_receiver>;
+    std::vector<int>      order;
+    std::optional<op_t>   op1;
+    std::function<void()> fun1{[&order, &op1] {
+        order.push_back(1);
+        op1.reset();
+    }};
+    std::function<void()> fun2{[&order] { order.push_back(2); }};
+    std::function<void()> fun3{[&order, &loop] {
+        order.push_back(3);
+        loop.finish();
+    }};
+
+    auto connect{[&strand](std::function<void()>* fun) {
+        return test_detail::emplace_from{[&strand, fun] {
+            return test_std::connect(test_std::schedule(strand.get_scheduler()), function_receiver{fun});
+        }};
+    }};
+    op1.emplace(connect(&fun1));
+    op_t op2(connect(&fun2));
+    op_t op3(connect(&fun3));
+    // the first operation schedules the drain; its completion destroys it while the others are queued
+    test_std::start(*op1);
+    test_std::start(op2);
+    test_std::start(op3);
+    loop.run();
+    ASSERT(not op1);
+    ASSERT((order == std::vector<int>{1, 2, 3}));
+}
+
+auto test_stopped() -> void {
+    test_std::strand<test::inline_scheduler> strand{test::inline_scheduler{}};
+    test_std::inplace_stop_source            source;
+    bool                                     stopped{};
+    auto op{test_std::connect(test_std::schedule(strand.get_scheduler()), stop_receiver{source.get_token(), &stopped})};
+    source.request_stop();
+    test_std::start(op);
+    ASSERT(stopped);
+}
+
+auto test_concurrent() -> void {
+    constexpr std::size_t threads{4u};
+    constexpr std::size_t size{20000u};
+    inline_strand         strand{test::inline_scheduler{}};
+    shared_state          state;
+
+    std::vector<std::deque<slot>> slots(threads);
+    for (auto& s : slots)
+        for (std::size_t i{}; i != size; ++i)
+            s.emplace_back(test_std::schedule(strand.get_scheduler()), count_receiver{&state});
+
+    std::vector<std::thread> workers;
+    for (auto& s : slots)
+        workers.emplace_back([&s] {
+            for (auto& sl : s)
+                test_std::start(sl.op);
+        });
+    for (auto& w : workers)
+        w.join();
+
+    ASSERT(state.count == threads * size);
+    ASSERT(not state.overlap);
+}
+} // namespace
+
+TEST(exec_strand) {
+    test_concepts();
+    test_fifo_burst();
+    test_destroy_in_completion();
+    test_stopped();
+    test_concurrent();
+}
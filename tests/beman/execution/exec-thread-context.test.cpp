@@ -0,0 +1,169 @@
+// tests/beman/execution/exec-thread-context.test.cpp               -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <beman/execution/detail/thread_context.hpp>
+#include <beman/execution/detail/inline_scheduler.hpp>
+#include <beman/execution/detail/connect.hpp>
+#include <beman/execution/detail/connect_result_t.hpp>
+#include <beman/execution/detail/emplace_from.hpp>
+#include <beman/execution/detail/get_completion_scheduler.hpp>
+#include <beman/execution/detail/get_completion_signatures.hpp>
+#include <beman/execution/detail/get_env.hpp>
+#include <beman/execution/detail/get_stop_token.hpp>
+#include <beman/execution/detail/inplace_stop_source.hpp>
+#include <beman/execution/detail/receiver.hpp>
+#include <beman/execution/detail/schedule.hpp>
+#include <beman/execution/detail/schedule_result_t.hpp>
+#include <beman/execution/detail/scheduler.hpp>
+#include <beman/execution/detail/start.hpp>
+#include <test/execution.hpp>
+#include <atomic>
+#include <concepts>
+#include <list>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// ----------------------------------------------------------------------------
+
+namespace {
+struct env {
+    test_std::inplace_stop_token token;
+    auto                         query(const test_std::get_stop_token_t&) const noexcept { return this->token; }
+};
+
+//! Receiver recording the order and thread of its completion.
+struct receiver {
+    using receiver_concept = test_std::receiver_t;
+    int                          id;
+    std::vector<int>*            order;
+    std::thread::id*             thread;
+    std::atomic<int>*            done;
+    test_std::inplace_stop_token token{};
+
+    auto set_value() && noexcept -> void {
+        this->order->push_back(this->id);
+        *this->thread = std::this_thread::get_id();
+        this->complete();
+    }
+    auto set_stopped() && noexcept -> void {
+        this->order->push_back(-this->id);
+        this->complete();
+    }
+    auto get_env() const noexcept -> env { return {this->token}; }
+    auto complete() -> void {
+        auto* d{this->done};
+        d->fetch_add(1);
+        d->notify_all();
+    }
+};
+
+using op_t = test_std::connect_result_t<
+    test_std::schedule_result_t<decltype(std::declval<test_std::thread_context&>().get_scheduler())>,
+    receiver>;
+
+auto wait_for(std::atomic<int>& counter, int value) -> void {
+    for (int current{counter.load()}; current != value; current = counter.load())
+        counter.wait(current);
+}
+
+auto test_inline_scheduler() -> void {
+    static_assert(test_std::scheduler<test_std::inline_scheduler>);
+    static_assert(std::is_empty_v<test_std::inline_scheduler>);
+    static_assert(std::is_empty_v<decltype(test_std::inline_scheduler{}.schedule())>);
+    static_assert(test_std::inline_scheduler{} == test_std::inline_scheduler{});
+
+    auto sndr{test_std::schedule(test_std::inline_scheduler{})};
+    static_assert(std::same_as<test_std::completion_signatures<test_std::set_value_t()>,
+                               decltype(test_std::get_completion_signatures(sndr, test_std::empty_env{}))>);
+    ASSERT(test_std::inline_scheduler{} ==
+           test_std::get_completion_scheduler<test_std::set_value_t>(test_std::get_env(sndr)));
+
+    std::vector<int> order;
+    std::thread::id  thread{};
+    std::atomic<int> done{};
+    auto             op{test_std::connect(sndr, receiver{1, &order, &thread, &done})};
+    ASSERT(done == 0);
+    test_std::start(op);
+    ASSERT(done == 1);
+    ASSERT(thread == std::this_thread::get_id());
+}
+
+auto test_thread_context() -> void {
+    constexpr int    count{1000};
+    std::vector<int> order;
+    std::thread::id  thread{};
+    std::atomic<int> done{};
+    std::list<op_t>  ops;
+    {
+        test_std::thread_context context;
+        auto                     sched{context.get_scheduler()};
+        static_assert(test_std::scheduler<decltype(sched)>);
+        ASSERT(sched == context.get_scheduler());
+        ASSERT(sched == test_std::get_completion_scheduler<test_std::set_value_t>(
+                            test_std::get_env(test_std::schedule(sched))));
+        ASSERT(context.get_id() != std::this_thread::get_id());
+
+        for (int i{1}; i <= count; ++i) {
+            ops.emplace_back(test_detail::emplace_from(
+                [&] { return test_std::connect(test_std::schedule(sched), receiver{i, &order, &thread, &done}); }));
+            test_std::start(ops.back());
+        }
+        wait_for(done, count);
+        ASSERT(thread == context.get_id());
+
+        test_std::inplace_stop_source source;
+        source.request_stop();
+        ops.emplace_back(test_detail::emplace_from([&] {
+            return test_std::connect(test_std::schedule(sched),
+                                     receiver{count + 1, &order, &thread, &done, source.get_token()});
+        }));
+        test_std::start(ops.back());
+        wait_for(done, count + 1);
+    }
+    ASSERT(order.size() == std::size_t(count + 1));
+    for (int i{}; i != count; ++i)
+        ASSERT(order[std::size_t(i)] == i + 1);
+    ASSERT(order.back() == -(count + 1));
+}
+
+auto test_producers() -> void {
+    constexpr int    per_thread{2000};
+    std::vector<int> order;
+    std::thread::id  thread{};
+    std::atomic<int> done{};
+    std::list<op_t>  ops[4];
+    {
+        test_std::thread_context context;
+        std::vector<std::thread> producers;
+        for (int t{}; t != 4; ++t)
+            producers.emplace_back([&, t] {
+                for (int i{}; i != per_thread; ++i) {
+                    ops[t].emplace_back(test_detail::emplace_from([&] {
+                        return test_std::connect(test_std::schedule(context.get_scheduler()),
+                                                 receiver{t * per_thread + i + 1, &order, &thread, &done});
+                    }));
+                    test_std::start(ops[t].back());
+                }
+            });
+        for (auto& p : producers)
+            p.join();
+        wait_for(done, 4 * per_thread);
+    }
+    // work of each producer runs in its submission order
+    int last[4]{};
+    for (int id : order) {
+        int t{(id - 1) / per_thread};
+        ASSERT(last[t] < id);
+        last[t] = id;
+    }
+}
+} // namespace
+
+TEST(exec_thread_context) {
+    test_inline_scheduler();
+    test_thread_context();
+    test_producers();
+}
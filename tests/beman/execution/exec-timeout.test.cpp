@@ -0,0 +1,179 @@
+// tests/beman/execution/exec-timeout.test.cpp                      -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <beman/execution/detail/timeout.hpp>
+#include <beman/execution/detail/timer_context.hpp>
+#include <beman/execution/detail/connect.hpp>
+#include <beman/execution/detail/get_completion_signatures.hpp>
+#include <beman/execution/detail/get_stop_token.hpp>
+#include <beman/execution/detail/inplace_stop_source.hpp>
+#include <beman/execution/detail/just.hpp>
+#include <beman/execution/detail/receiver.hpp>
+#include <beman/execution/detail/sender.hpp>
+#include <beman/execution/detail/start.hpp>
+#include <beman/execution/detail/stop_callback_for_t.hpp>
+#include <beman/execution/detail/stop_token_of_t.hpp>
+#include <test/execution.hpp>
+#include <atomic>
+#include <chrono>
+#include <concepts>
+#include <exception>
+#include <optional>
+#include <system_error>
+#include <utility>
+
+// ----------------------------------------------------------------------------
+
+namespace {
+using namespace std::chrono_literals;
+
+struct counter : test_std::timer_context::entry {
+    std::atomic<int>                   expired{};
+    test_std::timer_context::time_point when{};
+    auto                               expire() noexcept -> void override {
+        this->when = test_std::timer_context::clock::now();
+        this->expired.fetch_add(1);
+        this->expired.notify_all();
+    }
+};
+
+struct env {
+    test_std::inplace_stop_token token;
+    auto                         query(const test_std::get_stop_token_t&) const noexcept { return this->token; }
+};
+
+enum class completion : char { none, value, error, stopped };
+
+struct receiver {
+    using receiver_concept = test_std::receiver_t;
+    std::atomic<completion>*     comp;
+    std::error_code*             error;
+    test_std::inplace_stop_token token{};
+
+    auto set_value(int) && noexcept -> void { this->complete(completion::value); }
+    auto set_error(std::error_code ec) && noexcept -> void {
+        *this->error = ec;
+        this->complete(completion::error);
+    }
+    auto set_stopped() && noexcept -> void { this->complete(completion::stopped); }
+    auto get_env() const noexcept -> env { return {this->token}; }
+    auto complete(completion c) -> void {
+        this->comp->store(c);
+        this->comp->notify_all();
+    }
+};
+
+//! Sender completing with set_stopped() when stop is requested.
+struct stoppable_sender {
+    using sender_concept        = test_std::sender_t;
+    using completion_signatures =
+        test_std::completion_signatures<test_std::set_value_t(int), test_std::set_stopped_t()>;
+
+    template <typename Receiver>
+    struct state {
+        using operation_state_concept = test_std::operation_state_t;
+        using token_t                 = test_std::stop_token_of_t<test_std::env_of_t<Receiver>>;
+        struct cb_t {
+            state* st;
+            auto   operator()() const noexcept -> void { test_std::set_stopped(std::move(this->st->receiver)); }
+        };
+
+        Receiver                                                    receiver;
+        std::optional<test_std::stop_callback_for_t<token_t, cb_t>> callback{};
+
+        auto start() & noexcept -> void {
+            this->callback.emplace(test_std::get_stop_token(test_std::get_env(this->receiver)), cb_t{this});
+        }
+    };
+
+    template <typename Receiver>
+    auto connect(Receiver receiver) && -> state<Receiver> {
+        return {std::move(receiver)};
+    }
+};
+
+auto test_timer_context() -> void {
+    test_std::timer_context context;
+    ASSERT(context.resolution() == 1ms);
+    counter c0, c1, c2;
+    auto    start{test_std::timer_context::clock::now()};
+    context.add(c0, start + 5ms);
+    context.add(c1, start + 2ms);
+    context.add(c2, start + 2s);
+    ASSERT(context.size() == 3u);
+    ASSERT(context.cancel(c2));
+    ASSERT(not context.cancel(c2));
+    c0.expired.wait(0);
+    c1.expired.wait(0);
+    ASSERT(c0.expired == 1);
+    ASSERT(c1.expired == 1);
+    ASSERT(start + 5ms <= c0.when);
+    ASSERT(start + 2ms <= c1.when);
+    ASSERT(c2.expired == 0);
+    ASSERT(context.size() == 0u);
+    ASSERT(not context.cancel(c0));
+
+    counter past;
+    context.add(past, start - 1s);
+    past.expired.wait(0);
+    ASSERT(past.expired == 1);
+}
+
+auto test_completes_first() -> void {
+    test_std::timer_context context;
+    std::atomic<completion> comp{};
+    std::error_code         error{};
+    auto                    sndr{test_std::timeout(test_std::just(17), context, 1s)};
+    static_assert(test_std::sender<decltype(sndr)>);
+    auto op{test_std::connect(std::move(sndr), receiver{&comp, &error})};
+    test_std::start(op);
+    ASSERT(comp == completion::value);
+    ASSERT(context.size() == 0u);
+
+    static_assert(std::same_as<test_std::completion_signatures<test_std::set_value_t(int)>,
+                               decltype(test_std::get_completion_signatures(test_std::timeout(test_std::just(17), 1s),
+                                                                            test_std::empty_env{}))>);
+}
+
+auto test_expires() -> void {
+    test_std::timer_context context;
+    std::atomic<completion> comp{};
+    std::error_code         error{};
+    auto                    op{test_std::connect(stoppable_sender{} | test_std::timeout(context, 2ms),
+                                  receiver{&comp, &error})};
+    test_std::start(op);
+    comp.wait(completion::none);
+    ASSERT(comp == completion::error);
+    ASSERT(error == std::errc::timed_out);
+    ASSERT(context.size() == 0u);
+
+    std::atomic<completion> comp0{};
+    auto                    op0{test_std::connect(
+        test_std::with_deadline(stoppable_sender{}, test_std::timer_context::clock::now() + 1ms),
+        receiver{&comp0, &error})};
+    test_std::start(op0);
+    comp0.wait(completion::none);
+    ASSERT(comp0 == completion::error);
+}
+
+auto test_stopped() -> void {
+    test_std::timer_context       context;
+    test_std::inplace_stop_source source;
+    std::atomic<completion>       comp{};
+    std::error_code               error{};
+    auto                          op{test_std::connect(test_std::timeout(stoppable_sender{}, context, 1s),
+                                  receiver{&comp, &error, source.get_token()})};
+    test_std::start(op);
+    ASSERT(context.size() == 1u);
+    source.request_stop();
+    ASSERT(comp == completion::stopped);
+    ASSERT(context.size() == 0u);
+}
+} // namespace
+
+TEST(exec_timeout) {
+    test_timer_context();
+    test_completes_first();
+    test_expires();
+    test_stopped();
+}
@@ -0,0 +1,120 @@
+// tests/beman/execution/exec-trampoline-scheduler.test.cpp         -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <beman/execution/detail/trampoline_scheduler.hpp>
+#include <beman/execution/detail/connect.hpp>
+#include <beman/execution/detail/connect_result_t.hpp>
+#include <beman/execution/detail/get_completion_scheduler.hpp>
+#include <beman/execution/detail/get_completion_signatures.hpp>
+#include <beman/execution/detail/inplace_stop_source.hpp>
+#include <beman/execution/detail/receiver.hpp>
+#include <beman/execution/detail/schedule.hpp>
+#include <beman/execution/detail/schedule_result_t.hpp>
+#include <beman/execution/detail/scheduler.hpp>
+#include <beman/execution/detail/start.hpp>
+#include <test/execution.hpp>
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <deque>
+
+// ----------------------------------------------------------------------------
+
+namespace {
+struct chain;
+
+struct chain_receiver {
+    using receiver_concept = test_std::receiver_t;
+    chain*        c;
+    ::std::size_t index;
+
+    auto set_value() && noexcept -> void;
+    auto set_stopped() && noexcept -> void {}
+};
+
+using sender_t = test_std::schedule_result_t<test_std::trampoline_scheduler>;
+using op_t     = test_std::connect_result_t<sender_t, chain_receiver>;
+
+struct slot {
+    op_t op;
+    slot(sender_t s, chain_receiver r) : op(test_std::connect(s, r)) {}
+};
+
+struct chain {
+    std::deque<slot> slots;
+    std::size_t      depth{};
+    std::size_t      max_depth{};
+    std::size_t      completed{};
+};
+
+auto chain_receiver::set_value() && noexcept -> void {
+    ++this->c->completed;
+    ++this->c->depth;
+    this->c->max_depth = std::max(this->c->max_depth, this->c->depth);
+    if (this->index + 1u < this->c->slots.size())
+        test_std::start(this->c->slots[this->index + 1u].op);
+    --this->c->depth;
+}
+
+struct token_env {
+    test_std::inplace_stop_token token;
+    auto                         query(const test_std::get_stop_token_t&) const noexcept { return this->token; }
+};
+
+struct stop_receiver {
+    using receiver_concept = test_std::receiver_t;
+    test_std::inplace_stop_token token;
+    bool*                        value;
+    bool*                        stopped;
+
+    auto set_value() && noexcept -> void { *this->value = true; }
+    auto set_stopped() && noexcept -> void { *this->stopped = true; }
+    auto get_env() const noexcept -> token_env { return {this->token}; }
+};
+
+auto test_concepts() -> void {
+    test_std::trampoline_scheduler sched;
+    static_assert(test_std::scheduler<test_std::trampoline_scheduler>);
+    ASSERT(sched.max_depth() == test_std::trampoline_scheduler::default_max_depth);
+    ASSERT(test_std::trampoline_scheduler(0u).max_depth() == 1u);
+    ASSERT(sched == test_std::trampoline_scheduler());
+    ASSERT(sched != test_std::trampoline_scheduler(4u));
+
+    auto sndr{test_std::schedule(sched)};
+    static_assert(std::same_as<test_std::completion_signatures<test_std::set_value_t(), test_std::set_stopped_t()>,
+                               decltype(test_std::get_completion_signatures(sndr, test_std::empty_env{}))>);
+    ASSERT(sched == test_std::get_completion_scheduler<test_std::set_value_t>(test_std::get_env(sndr)));
+}
+
+auto test_bounded_depth(std::size_t max_depth, std::size_t size) -> void {
+    test_std::trampoline_scheduler sched(max_depth);
+    chain                          c;
+    for (std::size_t i{}; i != size; ++i)
+        c.slots.emplace_back(test_std::schedule(sched), chain_receiver{&c, i});
+    test_std::start(c.slots.front().op);
+    ASSERT(c.completed == size);
+    ASSERT(c.depth == 0u);
+    ASSERT(c.max_depth == std::min(max_depth, size));
+}
+
+auto test_stopped() -> void {
+    test_std::inplace_stop_source source;
+    bool                          value{};
+    bool                          stopped{};
+    auto op{test_std::connect(test_std::schedule(test_std::trampoline_scheduler()),
+                              stop_receiver{source.get_token(), &value, &stopped})};
+    source.request_stop();
+    test_std::start(op);
+    ASSERT(value == false);
+    ASSERT(stopped == true);
+}
+} // namespace
+
+TEST(exec_trampoline_scheduler) {
+    test_concepts();
+    test_bounded_depth(1u, 10u);
+    test_bounded_depth(4u, 3u);
+    test_bounded_depth(16u, 1000u);
+    test_bounded_depth(8u, 200000u);
+    test_stopped();
+}
@@ -17,4 +17,10 @@ TEST(meta_combine) {
     static_assert(std::same_as<type_list<bool, char>, test_detail::meta::combine<type_list<bool, char>, type_list<>>>);
     static_assert(std::same_as<type_list<bool, char, double, int>,
                                test_detail::meta::combine<type_list<bool, char>, type_list<double, int>>>);
+    static_assert(std::same_as<type_list<bool>, test_detail::meta::combine<type_list<bool>>>);
+    static_assert(std::same_as<type_list<bool, char, int>,
+                               test_detail::meta::combine<type_list<bool>, type_list<>, type_list<char, int>>>);
+    using five = test_detail::meta::
+        combine<type_list<bool>, type_list<char>, type_list<>, type_list<double, int>, type_list<long>>;
+    static_assert(std::same_as<type_list<bool, char, double, int, long>, five>);
 }
@@ -0,0 +1,30 @@
+// tests/beman/execution/meta-select.test.cpp                       -*-C++-*-
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <beman/execution/detail/meta_select.hpp>
+#include <test/execution.hpp>
+#include <concepts>
+
+// ----------------------------------------------------------------------------
+
+namespace {
+struct arg {};
+template <typename...>
+struct type_list {};
+} // namespace
+
+TEST(meta_select) {
+    static_assert(std::same_as<type_list<>, test_detail::meta::select<type_list<>>>);
+    static_assert(std::same_as<type_list<>, test_detail::meta::select<type_list<arg, bool>, false, false>>);
+    static_assert(std::same_as<type_list<arg, bool>, test_detail::meta::select<type_list<arg, bool>, true, true>>);
+    static_assert(std::same_as<type_list<arg, arg, double>,
+                               test_detail::meta::select<type_list<arg, bool, arg, char, double>,
+                                                         true,
+                                                         false,
+                                                         true,
+                                                         false,
+                                                         true>>);
+    // function types, e.g., completion signatures, are valid elements
+    static_assert(std::same_as<type_list<void(int)>,
+                               test_detail::meta::select<type_list<void(), void(int)>, false, true>>);
+}
@@ -4,12 +4,28 @@
 #include <beman/execution/detail/meta_unique.hpp>
 #include <test/execution.hpp>
 #include <concepts>
+#include <cstddef>
+#include <utility>
 
 // ----------------------------------------------------------------------------
 
 namespace {
 template <typename...>
 struct type_list {};
+
+template <std::size_t>
+struct tag {};
+//! A list of Size elements with Distinct different types.
+template <std::size_t Size, std::size_t Distinct, typename = std::make_index_sequence<Size>>
+struct make_list;
+template <std::size_t Size, std::size_t Distinct, std::size_t... I>
+struct make_list<Size, Distinct, std::index_sequence<I...>> {
+    using type = type_list<tag<I % Distinct>...>;
+};
+
+// distinct types whose names may be the same
+auto lambda0{[](int) {}};
+auto lambda1{[](int) {}};
 } // namespace
 
 TEST(meta_unique) {
@@ -26,4 +42,31 @@ TEST(meta_unique) {
                                test_detail::meta::unique<type_list<bool, char, double, char, bool>>>);
     static_assert(std::same_as<type_list<bool, char, double>,
                                test_detail::meta::unique<type_list<bool, char, double, bool, char>>>);
+    static_assert(std::same_as<type_list<int, bool, char, double, void(), void(int), long, short>,
+                               test_detail::meta::unique<type_list<int,
+                                                                   bool,
+                                                                   char,
+                                                                   int,
+                                                                   double,
+                                                                   void(),
+                                                                   bool,
+                                                                   void(int),
+                                                                   void(),
+                                                                   long,
+                                                                   int,
+                                                                   short,
+                                                                   char,
+                                                                   long,
+                                                                   double,
+                                                                   void(int),
+                                                                   short,
+                                                                   int,
+                                                                   bool>>>);
+    using lambda0_t = decltype(lambda0);
+    using lambda1_t = decltype(lambda1);
+    static_assert(std::same_as<type_list<lambda0_t, lambda1_t>,
+                               test_detail::meta::unique<type_list<lambda0_t, lambda1_t, lambda0_t, lambda1_t>>>);
+    static_assert(std::same_as<type_list<tag<0>, tag<1>, tag<2>, tag<3>, tag<4>, tag<5>, tag<6>>,
+                               test_detail::meta::unique<make_list<300u, 7u>::type>>);
+    static_assert(std::same_as<make_list<300u, 300u>::type, test_detail::meta::unique<make_list<300u, 300u>::type>>);
 }